@@ -70,8 +70,8 @@ FlashStorage flashStorage;
 
 #include "html.h"
 
-const Page page01 PROGMEM = {index_html_name, index_html, index_html_len};
-const Page page02 PROGMEM = {uptime_txt_name, uptime_txt, uptime_txt_len};
+const Page page01 PROGMEM = {index_html_name, index_html, index_html_len, index_html_etag};
+const Page page02 PROGMEM = {uptime_txt_name, uptime_txt, uptime_txt_len, uptime_txt_etag};
 
 const Page* const pages[] PROGMEM = {
 	&page01,
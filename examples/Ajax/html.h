@@ -108,6 +108,8 @@ const byte index_html[] PROGMEM = {
 
 const unsigned int index_html_len PROGMEM = 821;
 
+const uint32_t index_html_etag PROGMEM = 0x8b4187f8UL;
+
 const char uptime_txt_name[] PROGMEM = "/uptime.txt";
 
 const byte uptime_txt[] PROGMEM = {
@@ -117,10 +119,12 @@ const byte uptime_txt[] PROGMEM = {
 
 const unsigned int uptime_txt_len PROGMEM = 9;
 
+const uint32_t uptime_txt_etag PROGMEM = 0x0cbf3d57UL;
+
 /*** CODE TO INCLUDE IN SKETCH ***
 
-const Page page01 PROGMEM = {index_html_name, index_html, index_html_len, NULL};
-const Page page02 PROGMEM = {uptime_txt_name, uptime_txt, uptime_txt_len, NULL};
+const Page page01 PROGMEM = {index_html_name, index_html, index_html_len, index_html_etag};
+const Page page02 PROGMEM = {uptime_txt_name, uptime_txt, uptime_txt_len, uptime_txt_etag};
 
 const Page* const pages[] PROGMEM = {
 	&page01,
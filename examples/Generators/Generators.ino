@@ -0,0 +1,167 @@
+/***************************************************************************
+ *   This file is part of Webbino.                                         *
+ *                                                                         *
+ *   Copyright (C) 2012-2019 by SukkoPera                                  *
+ *                                                                         *
+ *   Webbino is free software: you can redistribute it and/or modify       *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation, either version 3 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   Webbino is distributed in the hope that it will be useful,            *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with Webbino. If not, see <http://www.gnu.org/licenses/>.       *
+ ***************************************************************************/
+
+#include <Webbino.h>
+
+// Instantiate the WebServer and page storage
+WebServer webserver;
+GeneratorStorage genStorage;
+
+// Instantiate the network interface defined in the Webbino headers
+#if defined (WEBBINO_USE_ENC28J60)
+	#include <WebbinoInterfaces/ENC28J60.h>
+	NetworkInterfaceENC28J60 netint;
+#elif defined (WEBBINO_USE_WIZ5100) || defined (WEBBINO_USE_WIZ5500)
+	#include <WebbinoInterfaces/WIZ5x00.h>
+	NetworkInterfaceWIZ5x00 netint;
+#elif defined (WEBBINO_USE_ESP8266)
+	#include <WebbinoInterfaces/AllWiFi.h>
+
+	#include <SoftwareSerial.h>
+	SoftwareSerial swSerial (6, 7);
+
+	// Wi-Fi parameters
+	#define WIFI_SSID        "ssid"
+	#define WIFI_PASSWORD    "password"
+
+	NetworkInterfaceWiFi netint;
+#elif defined (WEBBINO_USE_WIFI) || defined (WEBBINO_USE_WIFI101) || \
+	  defined (WEBBINO_USE_ESP8266_STANDALONE)
+	#include <WebbinoInterfaces/AllWiFi.h>
+
+	// Wi-Fi parameters
+	#define WIFI_SSID        "ssid"
+	#define WIFI_PASSWORD    "password"
+
+	NetworkInterfaceWiFi netint;
+#elif defined (WEBBINO_USE_FISHINO)
+	#include <WebbinoInterfaces/FishinoIntf.h>
+
+	// Wi-Fi parameters
+	#define WIFI_SSID        "ssid"
+	#define WIFI_PASSWORD    "password"
+
+	FishinoInterface netint;
+#elif defined (WEBBINO_USE_DIGIFI)
+	#include <WebbinoInterfaces/DigiFi.h>
+	NetworkInterfaceDigiFi netint;
+#endif
+
+
+/******************************************************************************
+ * DEFINITION OF PAGES                                                        *
+ ******************************************************************************/
+
+/* These pages have no file behind them: whatever the functions below print is
+ * sent to the client as it is produced.
+ */
+void writeStatus (Print& out, HTTPRequestParser& request, void *data) {
+	(void) request;
+	(void) data;
+
+	JsonWriter json (out);
+	json.beginObject ();
+	json.key (F("version")).value (F(WEBBINO_VERSION));
+	json.key (F("uptime")).value (millis () / 1000);
+	json.endObject ();
+}
+
+// Prints the value of all analog inputs, each one sampled n times (Default: 10)
+void writeReadings (Print& out, HTTPRequestParser& request, void *data) {
+	(void) data;
+
+	int n = atoi (request.get_parameter (F("n")));
+	if (n <= 0)
+		n = 10;
+
+	out.print (F("sample"));
+	for (byte pin = 0; pin < NUM_ANALOG_INPUTS; ++pin) {
+		out.print (F(",A"));
+		out.print (pin);
+	}
+	out.print (F("\r\n"));
+
+	for (int i = 0; i < n; ++i) {
+		out.print (i);
+		for (byte pin = 0; pin < NUM_ANALOG_INPUTS; ++pin) {
+			out.print (',');
+			out.print (analogRead (A0 + pin));
+		}
+		out.print (F("\r\n"));
+	}
+}
+
+EasyGenerator (genStatus, "/status.json", "application/json", writeStatus);
+EasyGenerator (genReadings, "/readings.csv", "text/csv", writeReadings);
+
+GeneratorEntryArray generators[] PROGMEM = {
+	&genStatus,
+	&genReadings,
+	NULL
+};
+
+
+/******************************************************************************
+ * MAIN STUFF                                                                 *
+ ******************************************************************************/
+
+void setup () {
+	Serial.begin (115200);
+	while (!Serial)
+		;
+
+	Serial.println (F("Webbino " WEBBINO_VERSION));
+
+	Serial.println (F("Trying to get an IP address through DHCP"));
+#if defined (WEBBINO_USE_ENC28J60) || defined (WEBBINO_USE_WIZ5100) || defined (WEBBINO_USE_WIZ5500)
+	byte mac[6] = {0x00, 0x11, 0x22, 0x33, 0x44, 0x55};
+	bool ok = netint.begin (mac);
+#elif defined (WEBBINO_USE_ESP8266)
+	swSerial.begin (9600);
+	bool ok = netint.begin (swSerial, WIFI_SSID, WIFI_PASSWORD);
+#elif defined (WEBBINO_USE_WIFI) || defined (WEBBINO_USE_WIFI101) || \
+	  defined (WEBBINO_USE_ESP8266_STANDALONE) || defined (WEBBINO_USE_FISHINO)
+	bool ok = netint.begin (WIFI_SSID, WIFI_PASSWORD);
+#elif defined (WEBBINO_USE_DIGIFI)
+	bool ok = netint.begin ();
+#endif
+
+	if (!ok) {
+		Serial.println (F("Failed to get configuration from DHCP"));
+		while (42)
+			;
+	} else {
+		Serial.println (F("DHCP configuration done:"));
+		Serial.print (F("- IP: "));
+		Serial.println (netint.getIP ());
+		Serial.print (F("- Netmask: "));
+		Serial.println (netint.getNetmask ());
+		Serial.print (F("- Default Gateway: "));
+		Serial.println (netint.getGateway ());
+
+		webserver.begin (netint);
+
+		genStorage.begin (generators);
+		webserver.addStorage (genStorage);
+	}
+}
+
+void loop () {
+	webserver.loop ();
+}
@@ -0,0 +1,70 @@
+/***************************************************************************
+ *   This file is part of Webbino.                                         *
+ *                                                                         *
+ *   Copyright (C) 2012-2019 by SukkoPera                                  *
+ *                                                                         *
+ *   Webbino is free software: you can redistribute it and/or modify       *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation, either version 3 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   Webbino is distributed in the hope that it will be useful,            *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with Webbino. If not, see <http://www.gnu.org/licenses/>.       *
+ ***************************************************************************/
+
+/* This sketch runs on a PC, serving the contents of a local directory. It is
+ * handy to try out websites and to benchmark Webbino without flashing anything
+ * to a board.
+ *
+ * It needs an implementation of the Arduino API for the host, such as
+ * EpoxyDuino (https://github.com/bxparks/EpoxyDuino), and WEBBINO_USE_HOST_SOCKETS
+ * to be defined in webbino_config.h.
+ */
+
+#include <Webbino.h>
+#include <WebbinoInterfaces/HostSockets.h>
+
+// Directory to serve, relative to where the program is started
+#define WEBROOT "webroot"
+
+// Ports below 1024 can only be used by root
+#define PORT 8080
+
+// Instantiate the WebServer, page storage and network interface
+WebServer webserver;
+HostStorage hostStorage;
+NetworkInterfaceHost netint;
+
+
+/******************************************************************************
+ * MAIN STUFF                                                                 *
+ ******************************************************************************/
+
+void setup () {
+	Serial.begin (115200);
+
+	Serial.println (F("Webbino " WEBBINO_VERSION));
+
+	if (!netint.begin (PORT)) {
+		Serial.println (F("Cannot listen on port"));
+		exit (1);
+	} else if (!hostStorage.begin (WEBROOT)) {
+		Serial.println (F("Cannot access " WEBROOT));
+		exit (1);
+	} else {
+		Serial.print (F("Serving " WEBROOT " on port "));
+		Serial.println (PORT);
+
+		webserver.begin (netint);
+		webserver.addStorage (hostStorage);
+	}
+}
+
+void loop () {
+	webserver.loop ();
+}
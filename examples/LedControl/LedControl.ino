@@ -85,7 +85,7 @@ boolean ledState = false;
 
 #include "html.h"
 
-const Page page01 PROGMEM = {index_html_name, index_html, index_html_len};
+const Page page01 PROGMEM = {index_html_name, index_html, index_html_len, index_html_etag};
 
 const Page* const pages[] PROGMEM = {
 	&page01,
@@ -101,22 +101,33 @@ const Page* const pages[] PROGMEM = {
 #error Please define ENABLE_PAGE_FUNCTIONS in webbino_config.h
 #endif
 
-void ledToggle (HTTPRequestParser& request) {
-	char *param;
-
-	param = request.get_parameter (F("state"));
-	if (strlen (param) > 0) {
-		if (strcmp_P (param, PSTR ("on")) == 0) {
-			ledState = true;
-			digitalWrite (ledPin, LED_ACTIVE_LEVEL);
-		} else {
-			ledState = false;
-			digitalWrite (ledPin, !LED_ACTIVE_LEVEL);
-		}
+/* Parameters the page function expects: these will be extracted from the
+ * request and converted before the function is called
+ */
+struct LedParams {
+	boolean state;
+};
+
+LedParams ledParams;
+
+PageParamBool (paramState, "state", LedParams, state, false);
+
+PageParameterArray ledParamSpec[] PROGMEM = {
+	&paramState,
+	NULL
+};
+
+void ledToggle (HTTPRequestParser& request _UNUSED, void *data, PageParamMask found) {
+	LedParams& params = *reinterpret_cast<LedParams *> (data);
+
+	if (found & PAGEPARAM_BIT (0)) {
+		// Parameter "state" was specified and is either on or off
+		ledState = params.state;
+		digitalWrite (ledPin, ledState ? LED_ACTIVE_LEVEL : !LED_ACTIVE_LEVEL);
 	}
 }
 
-FlashFileFuncAssoc (indexAss, index_html_name, ledToggle);
+FlashBoundFileFuncAssoc (indexAss, index_html_name, ledToggle, ledParamSpec, ledParams);
 
 FileFuncAssociationArray associations[] PROGMEM = {
 	&indexAss,
@@ -0,0 +1,598 @@
+/* Packed image generated by html2h.py, do not edit */
+
+const byte site_data[] PROGMEM = {
+	0x2f,  0x69,  0x6e,  0x64,  0x65,  0x78,  0x2e,  0x68,  
+	0x74,  0x6d,  0x6c,  0x00,  0x2f,  0x6c,  0x6f,  0x67,  
+	0x6f,  0x2e,  0x67,  0x69,  0x66,  0x00,  0x3c,  0x68,  
+	0x74,  0x6d,  0x6c,  0x3e,  0x3c,  0x62,  0x6f,  0x64,  
+	0x79,  0x3e,  0x3c,  0x68,  0x32,  0x3e,  0x57,  0x65,  
+	0x62,  0x62,  0x69,  0x6e,  0x6f,  0x3c,  0x2f,  0x68,  
+	0x32,  0x3e,  0x3c,  0x68,  0x33,  0x3e,  0x3c,  0x61,  
+	0x20,  0x68,  0x72,  0x65,  0x66,  0x3d,  0x22,  0x68,  
+	0x74,  0x74,  0x70,  0x73,  0x3a,  0x2f,  0x2f,  0x67,  
+	0x69,  0x74,  0x68,  0x75,  0x62,  0x2e,  0x63,  0x6f,  
+	0x6d,  0x2f,  0x53,  0x75,  0x6b,  0x6b,  0x6f,  0x50,  
+	0x65,  0x72,  0x61,  0x2f,  0x57,  0x65,  0x62,  0x62,  
+	0x69,  0x6e,  0x6f,  0x22,  0x3e,  0x68,  0x74,  0x74,  
+	0x70,  0x73,  0x3a,  0x2f,  0x2f,  0x67,  0x69,  0x74,  
+	0x68,  0x75,  0x62,  0x2e,  0x63,  0x6f,  0x6d,  0x2f,  
+	0x53,  0x75,  0x6b,  0x6b,  0x6f,  0x50,  0x65,  0x72,  
+	0x61,  0x2f,  0x57,  0x65,  0x62,  0x62,  0x69,  0x6e,  
+	0x6f,  0x3c,  0x2f,  0x61,  0x3e,  0x3c,  0x2f,  0x68,  
+	0x33,  0x3e,  0x3c,  0x68,  0x33,  0x3e,  0x43,  0x6f,  
+	0x70,  0x79,  0x72,  0x69,  0x67,  0x68,  0x74,  0x20,  
+	0x28,  0x43,  0x29,  0x20,  0x32,  0x30,  0x31,  0x32,  
+	0x2d,  0x32,  0x30,  0x31,  0x39,  0x20,  0x42,  0x79,  
+	0x20,  0x3c,  0x61,  0x20,  0x68,  0x72,  0x65,  0x66,  
+	0x3d,  0x22,  0x6d,  0x61,  0x69,  0x6c,  0x74,  0x6f,  
+	0x3a,  0x73,  0x6f,  0x66,  0x74,  0x77,  0x61,  0x72,  
+	0x65,  0x40,  0x73,  0x75,  0x6b,  0x6b,  0x6f,  0x6c,  
+	0x6f,  0x67,  0x79,  0x2e,  0x6e,  0x65,  0x74,  0x22,  
+	0x3e,  0x53,  0x75,  0x6b,  0x6b,  0x6f,  0x50,  0x65,  
+	0x72,  0x61,  0x3c,  0x2f,  0x61,  0x3e,  0x3c,  0x2f,  
+	0x68,  0x33,  0x3e,  0x3c,  0x68,  0x34,  0x3e,  0x54,  
+	0x68,  0x69,  0x73,  0x20,  0x70,  0x72,  0x6f,  0x67,  
+	0x72,  0x61,  0x6d,  0x20,  0x63,  0x6f,  0x6d,  0x65,  
+	0x73,  0x20,  0x77,  0x69,  0x74,  0x68,  0x20,  0x41,  
+	0x42,  0x53,  0x4f,  0x4c,  0x55,  0x54,  0x45,  0x4c,  
+	0x59,  0x20,  0x4e,  0x4f,  0x20,  0x57,  0x41,  0x52,  
+	0x52,  0x41,  0x4e,  0x54,  0x59,  0x2e,  0x20,  0x54,  
+	0x68,  0x69,  0x73,  0x20,  0x69,  0x73,  0x20,  0x66,  
+	0x72,  0x65,  0x65,  0x20,  0x73,  0x6f,  0x66,  0x74,  
+	0x77,  0x61,  0x72,  0x65,  0x2c,  0x20,  0x61,  0x6e,  
+	0x64,  0x20,  0x79,  0x6f,  0x75,  0x20,  0x61,  0x72,  
+	0x65,  0x20,  0x77,  0x65,  0x6c,  0x63,  0x6f,  0x6d,  
+	0x65,  0x20,  0x74,  0x6f,  0x20,  0x72,  0x65,  0x64,  
+	0x69,  0x73,  0x74,  0x72,  0x69,  0x62,  0x75,  0x74,  
+	0x65,  0x20,  0x69,  0x74,  0x20,  0x75,  0x6e,  0x64,  
+	0x65,  0x72,  0x20,  0x63,  0x65,  0x72,  0x74,  0x61,  
+	0x69,  0x6e,  0x20,  0x63,  0x6f,  0x6e,  0x64,  0x69,  
+	0x74,  0x69,  0x6f,  0x6e,  0x73,  0x3b,  0x20,  0x3c,  
+	0x61,  0x20,  0x68,  0x72,  0x65,  0x66,  0x3d,  0x22,  
+	0x68,  0x74,  0x74,  0x70,  0x3a,  0x2f,  0x2f,  0x77,  
+	0x77,  0x77,  0x2e,  0x67,  0x6e,  0x75,  0x2e,  0x6f,  
+	0x72,  0x67,  0x2f,  0x6c,  0x69,  0x63,  0x65,  0x6e,  
+	0x73,  0x65,  0x73,  0x2f,  0x67,  0x70,  0x6c,  0x2d,  
+	0x33,  0x2e,  0x30,  0x2e,  0x68,  0x74,  0x6d,  0x6c,  
+	0x22,  0x3e,  0x63,  0x6c,  0x69,  0x63,  0x6b,  0x20,  
+	0x68,  0x65,  0x72,  0x65,  0x3c,  0x2f,  0x61,  0x3e,  
+	0x20,  0x66,  0x6f,  0x72,  0x20,  0x64,  0x65,  0x74,  
+	0x61,  0x69,  0x6c,  0x73,  0x2e,  0x3c,  0x2f,  0x68,  
+	0x34,  0x3e,  0x3c,  0x69,  0x6d,  0x67,  0x20,  0x73,  
+	0x72,  0x63,  0x3d,  0x22,  0x6c,  0x6f,  0x67,  0x6f,  
+	0x2e,  0x67,  0x69,  0x66,  0x22,  0x20,  0x2f,  0x3e,  
+	0x3c,  0x2f,  0x62,  0x6f,  0x64,  0x79,  0x3e,  0x3c,  
+	0x2f,  0x68,  0x74,  0x6d,  0x6c,  0x3e,  0x47,  0x49,  
+	0x46,  0x38,  0x39,  0x61,  0x80,  0x00,  0x5e,  0x00,  
+	0xe7,  0xff,  0x00,  0x00,  0x98,  0xa0,  0x05,  0x98,  
+	0x9a,  0x00,  0x9a,  0xa2,  0x09,  0x99,  0x9b,  0x0d,  
+	0x9a,  0x9c,  0x10,  0x9b,  0x9d,  0x13,  0x9c,  0x9e,  
+	0x16,  0x9d,  0x9f,  0x18,  0x9e,  0xa1,  0x29,  0x9a,  
+	0x9d,  0x1b,  0x9f,  0xa2,  0x2b,  0x9b,  0x9f,  0x1d,  
+	0xa0,  0xa3,  0x2c,  0x9c,  0xa0,  0x1f,  0xa1,  0xa4,  
+	0x2e,  0x9d,  0xa1,  0x21,  0xa2,  0xa5,  0x2f,  0x9e,  
+	0xa2,  0x31,  0x9f,  0xa3,  0x32,  0xa0,  0xa4,  0x25,  
+	0xa4,  0xa7,  0x34,  0xa1,  0xa5,  0x35,  0xa2,  0xa6,  
+	0x36,  0xa3,  0xa7,  0x42,  0xa0,  0xa6,  0x38,  0xa4,  
+	0xa8,  0x43,  0xa2,  0xa7,  0x39,  0xa5,  0xa9,  0x3a,  
+	0xa6,  0xaa,  0x45,  0xa3,  0xa8,  0x46,  0xa4,  0xa9,  
+	0x3c,  0xa7,  0xab,  0x47,  0xa5,  0xaa,  0x3d,  0xa8,  
+	0xac,  0x48,  0xa6,  0xab,  0x3e,  0xa9,  0xad,  0x49,  
+	0xa7,  0xac,  0x4b,  0xa8,  0xad,  0x54,  0xa6,  0xac,  
+	0x41,  0xac,  0xaf,  0x4c,  0xa9,  0xae,  0x4d,  0xaa,  
+	0xaf,  0x5a,  0xa7,  0xa8,  0x56,  0xa8,  0xae,  0x4e,  
+	0xab,  0xb0,  0x4f,  0xac,  0xb2,  0x58,  0xaa,  0xb1,  
+	0x54,  0xac,  0xac,  0x50,  0xad,  0xb3,  0x59,  0xab,  
+	0xb2,  0x5a,  0xac,  0xb3,  0x5f,  0xac,  0xad,  0x53,  
+	0xb0,  0xb5,  0x5c,  0xae,  0xb5,  0x54,  0xb1,  0xb6,  
+	0x61,  0xae,  0xaf,  0x69,  0xac,  0xae,  0x5e,  0xaf,  
+	0xb6,  0x62,  0xaf,  0xb0,  0x5f,  0xb0,  0xb7,  0x63,  
+	0xb0,  0xb1,  0x64,  0xb1,  0xb2,  0x60,  0xb2,  0xb8,  
+	0x6c,  0xaf,  0xb2,  0x58,  0xb5,  0xba,  0x65,  0xb2,  
+	0xb3,  0x61,  0xb3,  0xb9,  0x67,  0xb4,  0xb4,  0x6f,  
+	0xb2,  0xb4,  0x68,  0xb5,  0xb5,  0x70,  0xb3,  0xb6,  
+	0x5c,  0xb9,  0xbe,  0x69,  0xb6,  0xb6,  0x71,  0xb4,  
+	0xb7,  0x6a,  0xb7,  0xb8,  0x67,  0xb8,  0xbe,  0x6b,  
+	0xb8,  0xb9,  0x73,  0xb6,  0xb9,  0x6c,  0xb9,  0xba,  
+	0x7b,  0xb5,  0xb9,  0x6d,  0xba,  0xbb,  0x74,  0xb8,  
+	0xba,  0x6e,  0xbb,  0xbc,  0x75,  0xb9,  0xbb,  0x7d,  
+	0xb7,  0xbb,  0x6f,  0xbc,  0xbd,  0x76,  0xba,  0xbc,  
+	0x7e,  0xb8,  0xbc,  0x77,  0xbb,  0xbd,  0x7f,  0xb9,  
+	0xbd,  0x78,  0xbc,  0xbe,  0x80,  0xba,  0xbe,  0x72,  
+	0xbf,  0xc0,  0x7a,  0xbd,  0xbf,  0x81,  0xbb,  0xbf,  
+	0x7b,  0xbe,  0xc0,  0x7c,  0xbf,  0xc1,  0x83,  0xbe,  
+	0xc1,  0x7d,  0xc0,  0xc2,  0x84,  0xbf,  0xc2,  0x8b,  
+	0xbd,  0xc2,  0x7e,  0xc1,  0xc3,  0x85,  0xc0,  0xc4,  
+	0x7f,  0xc2,  0xc5,  0x87,  0xc1,  0xc5,  0x8e,  0xbf,  
+	0xc5,  0x81,  0xc4,  0xc7,  0x88,  0xc2,  0xc6,  0x89,  
+	0xc3,  0xc7,  0x82,  0xc6,  0xc8,  0x8a,  0xc4,  0xc8,  
+	0x7c,  0xc9,  0xca,  0x83,  0xc7,  0xc9,  0x91,  0xc3,  
+	0xc8,  0x8b,  0xc5,  0xc9,  0x84,  0xc8,  0xca,  0x8c,  
+	0xc6,  0xca,  0x93,  0xc4,  0xca,  0x8d,  0xc7,  0xcb,  
+	0x90,  0xc7,  0xc5,  0x97,  0xc5,  0xc5,  0x94,  0xc6,  
+	0xcb,  0x8e,  0xc8,  0xcc,  0x95,  0xc7,  0xcc,  0x98,  
+	0xc7,  0xc6,  0x8f,  0xca,  0xcd,  0x96,  0xc8,  0xcd,  
+	0x99,  0xc8,  0xc8,  0xa0,  0xc6,  0xc8,  0x89,  0xcd,  
+	0xcf,  0x90,  0xcb,  0xce,  0x97,  0xc9,  0xcf,  0x9a,  
+	0xc9,  0xc9,  0x9b,  0xca,  0xca,  0x92,  0xcd,  0xd0,  
+	0xa2,  0xc9,  0xca,  0x95,  0xcd,  0xcb,  0x9c,  0xcb,  
+	0xcb,  0x93,  0xce,  0xd2,  0xa3,  0xca,  0xcb,  0x9d,  
+	0xcc,  0xcc,  0x9b,  0xcd,  0xd3,  0xa5,  0xcb,  0xcd,  
+	0x9f,  0xcd,  0xcd,  0x95,  0xd0,  0xd4,  0xa0,  0xce,  
+	0xce,  0xa6,  0xcd,  0xce,  0x9e,  0xd0,  0xd5,  0xa7,  
+	0xce,  0xcf,  0xa1,  0xd0,  0xcf,  0xa8,  0xcf,  0xd0,  
+	0xa2,  0xd1,  0xd0,  0xa0,  0xd2,  0xd7,  0xa3,  0xd2,  
+	0xd1,  0xaa,  0xd0,  0xd1,  0xa4,  0xd3,  0xd2,  0xab,  
+	0xd1,  0xd3,  0xa2,  0xd4,  0xda,  0xb1,  0xd0,  0xd3,  
+	0xa5,  0xd4,  0xd4,  0xac,  0xd2,  0xd4,  0xa6,  0xd5,  
+	0xd5,  0xad,  0xd3,  0xd5,  0xa7,  0xd6,  0xd6,  0xae,  
+	0xd5,  0xd6,  0xb5,  0xd4,  0xd6,  0xaf,  0xd6,  0xd7,  
+	0xa9,  0xd8,  0xd8,  0xb0,  0xd7,  0xd8,  0xb1,  0xd8,  
+	0xd9,  0xb8,  0xd6,  0xd9,  0xb2,  0xd9,  0xda,  0xb9,  
+	0xd7,  0xda,  0xb3,  0xda,  0xdb,  0xba,  0xd8,  0xdb,  
+	0xb4,  0xdb,  0xdc,  0xbb,  0xda,  0xdd,  0xb5,  0xdc,  
+	0xde,  0xc2,  0xd9,  0xde,  0xbc,  0xdb,  0xde,  0xbe,  
+	0xdb,  0xd8,  0xc5,  0xd9,  0xd8,  0xbd,  0xdc,  0xdf,  
+	0xbe,  0xdd,  0xe0,  0xb8,  0xdf,  0xe0,  0xc7,  0xdb,  
+	0xda,  0xbf,  0xde,  0xe1,  0xc0,  0xdf,  0xe2,  0xc1,  
+	0xe0,  0xe3,  0xc2,  0xe1,  0xe4,  0xcb,  0xdf,  0xde,  
+	0xc9,  0xe0,  0xe4,  0xc4,  0xe2,  0xe5,  0xcc,  0xe1,  
+	0xdf,  0xbe,  0xe5,  0xe6,  0xc7,  0xe3,  0xe0,  0xcb,  
+	0xe2,  0xe7,  0xcd,  0xe2,  0xe1,  0xc5,  0xe4,  0xe7,  
+	0xcc,  0xe3,  0xe8,  0xc6,  0xe5,  0xe8,  0xcf,  0xe3,  
+	0xe2,  0xcd,  0xe4,  0xe9,  0xc7,  0xe6,  0xe9,  0xc9,  
+	0xe6,  0xe3,  0xd0,  0xe4,  0xe3,  0xce,  0xe5,  0xea,  
+	0xc8,  0xe7,  0xea,  0xd1,  0xe5,  0xe4,  0xcf,  0xe6,  
+	0xeb,  0xd2,  0xe6,  0xe5,  0xca,  0xe9,  0xec,  0xd3,  
+	0xe7,  0xe6,  0xcb,  0xea,  0xed,  0xd4,  0xe8,  0xe7,  
+	0xdb,  0xe7,  0xe8,  0xd5,  0xea,  0xe8,  0xdc,  0xe9,  
+	0xea,  0xd6,  0xeb,  0xe9,  0xdd,  0xea,  0xeb,  0xd7,  
+	0xec,  0xeb,  0xd8,  0xed,  0xec,  0xdf,  0xeb,  0xec,  
+	0xe0,  0xec,  0xed,  0xda,  0xee,  0xed,  0xe1,  0xed,  
+	0xee,  0xdb,  0xef,  0xee,  0xe2,  0xee,  0xef,  0xdc,  
+	0xf0,  0xef,  0xe3,  0xf0,  0xf0,  0xe4,  0xf1,  0xf1,  
+	0xe5,  0xf2,  0xf3,  0xe6,  0xf3,  0xf4,  0xe7,  0xf4,  
+	0xf5,  0xee,  0xf3,  0xf6,  0xe9,  0xf5,  0xf6,  0xea,  
+	0xf6,  0xf7,  0xf0,  0xf5,  0xf7,  0xf1,  0xf6,  0xf8,  
+	0xeb,  0xf8,  0xf8,  0xf2,  0xf7,  0xfa,  0xec,  0xf9,  
+	0xf9,  0xf3,  0xf8,  0xfb,  0xed,  0xfa,  0xfb,  0xf4,  
+	0xf9,  0xfc,  0xee,  0xfb,  0xfc,  0xf5,  0xfa,  0xfd,  
+	0xf7,  0xfb,  0xfe,  0xf9,  0xfb,  0xf8,  0xf8,  0xfc,  
+	0xff,  0xfa,  0xfc,  0xf9,  0xfb,  0xfd,  0xfa,  0xf9,  
+	0xfe,  0xff,  0xfa,  0xff,  0xff,  0xfc,  0xff,  0xfb,  
+	0xfd,  0xff,  0xfc,  0x21,  0xfe,  0x11,  0x43,  0x72,  
+	0x65,  0x61,  0x74,  0x65,  0x64,  0x20,  0x77,  0x69,  
+	0x74,  0x68,  0x20,  0x47,  0x49,  0x4d,  0x50,  0x00,  
+	0x2c,  0x00,  0x00,  0x00,  0x00,  0x80,  0x00,  0x5e,  
+	0x00,  0x00,  0x08,  0xfe,  0x00,  0xfd,  0x09,  0x1c,  
+	0x48,  0xb0,  0xa0,  0xc1,  0x83,  0x08,  0x13,  0x2a,  
+	0x5c,  0xc8,  0xb0,  0xa1,  0xc3,  0x87,  0x10,  0x23,  
+	0x4a,  0x9c,  0x48,  0xb1,  0xa2,  0xc5,  0x8b,  0x18,  
+	0x33,  0x6a,  0xdc,  0xc8,  0xb1,  0xa3,  0xc7,  0x8f,  
+	0x20,  0x43,  0x8a,  0x1c,  0x49,  0x72,  0x9f,  0xbe,  
+	0x7c,  0xf8,  0x52,  0xa6,  0xcc,  0xa7,  0x6f,  0x1f,  
+	0x49,  0x87,  0x26,  0x51,  0xaa,  0xc4,  0xc7,  0xd2,  
+	0xe5,  0xcb,  0x87,  0xeb,  0xa8,  0xd1,  0xea,  0xb3,  
+	0x84,  0x05,  0x87,  0x0b,  0x15,  0x32,  0x7c,  0x48,  
+	0x81,  0x84,  0x8e,  0xaa,  0x66,  0xe6,  0x6c,  0xde,  
+	0x14,  0xb8,  0xcf,  0x1c,  0x34,  0x56,  0x76,  0x90,  
+	0xb0,  0xf8,  0x90,  0xa1,  0x42,  0x87,  0x0f,  0x2c,  
+	0x90,  0xf4,  0x71,  0x25,  0x6d,  0xdd,  0xd2,  0x83,  
+	0xfb,  0xda,  0xf1,  0xc2,  0x22,  0xe2,  0x40,  0x80,  
+	0xb3,  0x68,  0xd3,  0xa2,  0x35,  0xe0,  0x81,  0xc8,  
+	0xa5,  0x72,  0xf7,  0x48,  0xde,  0x33,  0xb7,  0x89,  
+	0x08,  0x08,  0xb3,  0x6a,  0xf3,  0x06,  0x38,  0x00,  
+	0x62,  0xca,  0xad,  0x75,  0x4a,  0x0d,  0xe6,  0x73,  
+	0xc7,  0xce,  0x9d,  0x3f,  0xc3,  0x18,  0xf7,  0x81,  
+	0xe3,  0x23,  0x62,  0x80,  0xde,  0xc7,  0x6a,  0x25,  
+	0x4c,  0x59,  0x85,  0xd8,  0xe3,  0x3d,  0x57,  0x59,  
+	0x26,  0x40,  0xde,  0x1c,  0x60,  0xc0,  0x86,  0x3a,  
+	0xda,  0xf2,  0x1d,  0x04,  0xc7,  0xe5,  0x8d,  0x94,  
+	0x67,  0x65,  0x2a,  0x53,  0xfc,  0xc6,  0x26,  0x82,  
+	0x63,  0xce,  0xb0,  0x09,  0xb0,  0x70,  0xc5,  0x8e,  
+	0x63,  0x3c,  0x57,  0x2c,  0x0a,  0xc0,  0xde,  0xfd,  
+	0x60,  0x0c,  0xb8,  0x83,  0xa6,  0x84,  0x39,  0x39,  
+	0x72,  0xa4,  0x36,  0x45,  0x76,  0x94,  0x3c,  0xec,  
+	0x5e,  0x7e,  0x96,  0xc0,  0x8d,  0x60,  0x71,  0x2f,  
+	0xea,  0x73,  0xd6,  0x83,  0x00,  0xf3,  0xe5,  0x16,  
+	0x12,  0x19,  0x1f,  0xe8,  0x6a,  0x9a,  0x1d,  0x31,  
+	0x81,  0xb6,  0xfe,  0x47,  0x04,  0x37,  0xe4,  0xf5,  
+	0xf5,  0xe5,  0x07,  0xd8,  0x78,  0xad,  0xb8,  0x2e,  
+	0xcf,  0x83,  0xf3,  0xcc,  0x07,  0xf0,  0x90,  0x46,  
+	0xf0,  0x5e,  0xbe,  0x78,  0xee,  0xe2,  0x4d,  0xcc,  
+	0x77,  0xab,  0x03,  0xfc,  0xf3,  0x03,  0xc8,  0x40,  
+	0xdf,  0x44,  0xd8,  0xf8,  0x60,  0xde,  0x7f,  0xbb,  
+	0x4d,  0xa0,  0x8a,  0x68,  0x18,  0xdd,  0xa3,  0xc9,  
+	0x7b,  0x08,  0x9e,  0x67,  0xc1,  0x2b,  0x81,  0x31,  
+	0xb4,  0xcf,  0x2e,  0x19,  0x44,  0x78,  0xde,  0x01,  
+	0x92,  0x44,  0x57,  0x51,  0x3e,  0x89,  0xe8,  0xa6,  
+	0xe1,  0x79,  0x0f,  0x58,  0xc2,  0x20,  0x43,  0xf9,  
+	0x90,  0x12,  0xc1,  0x88,  0xe7,  0x11,  0xc0,  0x87,  
+	0x87,  0x12,  0xed,  0x43,  0x89,  0x01,  0xd7,  0x0d,  
+	0x40,  0x80,  0x03,  0x1b,  0x7c,  0x70,  0x01,  0x03,  
+	0x05,  0x0c,  0x70,  0x20,  0x6c,  0x06,  0x3c,  0x02,  
+	0x23,  0x42,  0xf9,  0x54,  0x42,  0x63,  0x8d,  0x04,  
+	0x1c,  0x40,  0xc1,  0x07,  0x1b,  0x40,  0xd0,  0xe3,  
+	0x75,  0x04,  0x08,  0x49,  0x51,  0x2a,  0x78,  0xc1,  
+	0x26,  0x01,  0x11,  0x7d,  0xe8,  0x62,  0x4e,  0x3b,  
+	0xee,  0x74,  0xd9,  0x8e,  0x39,  0xc0,  0x34,  0xf2,  
+	0x04,  0x08,  0x3f,  0x42,  0x56,  0xc0,  0x8b,  0x0a,  
+	0x15,  0xb9,  0xc0,  0x72,  0x03,  0x78,  0xf0,  0x84,  
+	0x21,  0xbb,  0x6c,  0xd9,  0x65,  0x97,  0x60,  0xf6,  
+	0x41,  0x84,  0x66,  0xbb,  0x19,  0x60,  0x0a,  0x81,  
+	0xfe,  0x71,  0xd6,  0xe6,  0x23,  0xde,  0x0c,  0x29,  
+	0x98,  0x39,  0xba,  0x20,  0xd1,  0xc0,  0x6e,  0x05,  
+	0x50,  0x52,  0xe1,  0x40,  0xfb,  0x98,  0xb2,  0x26,  
+	0x6c,  0x0b,  0x08,  0x71,  0x4b,  0x39,  0x8b,  0x16,  
+	0x74,  0x0f,  0x38,  0x94,  0x80,  0x60,  0x1d,  0x67,  
+	0x12,  0x00,  0x13,  0xd1,  0x3a,  0x3a,  0xc0,  0x56,  
+	0x81,  0x24,  0xeb,  0x3d,  0x94,  0x4f,  0x32,  0x59,  
+	0x6c,  0xba,  0x59,  0x03,  0xab,  0x20,  0x74,  0x0b,  
+	0x84,  0xfe,  0x9b,  0x11,  0x10,  0x05,  0x30,  0x82,  
+	0x2e,  0xb4,  0x8e,  0x26,  0x17,  0xc0,  0x16,  0x43,  
+	0xa9,  0x16,  0x3e,  0x52,  0x66,  0x5a,  0x03,  0x10,  
+	0x01,  0x4e,  0xa5,  0x0d,  0xdd,  0x73,  0x4b,  0x09,  
+	0xb0,  0x4d,  0xe0,  0x69,  0x41,  0xd8,  0xe4,  0xca,  
+	0x99,  0x07,  0xa8,  0xd4,  0xea,  0xd0,  0x37,  0x51,  
+	0xa8,  0xfa,  0x98,  0x1c,  0x27,  0x2e,  0x44,  0x8d,  
+	0x04,  0x9b,  0x15,  0x80,  0x87,  0x78,  0x14,  0x8d,  
+	0x63,  0x85,  0xb5,  0x7a,  0xa1,  0x50,  0x0e,  0x41,  
+	0xe6,  0xb0,  0xe0,  0x27,  0x12,  0xdf,  0x60,  0xe4,  
+	0xce,  0x1e,  0x22,  0x3e,  0xf6,  0x40,  0x33,  0xc5,  
+	0x86,  0xd1,  0x6d,  0x22,  0xd2,  0x4a,  0x14,  0x0f,  
+	0x1f,  0xf1,  0x3e,  0x86,  0x84,  0x7e,  0xfe,  0xdc,  
+	0xd3,  0x05,  0x67,  0x04,  0xac,  0x01,  0xee,  0x87,  
+	0x96,  0x3c,  0xea,  0x6f,  0xbe,  0x03,  0x61,  0x53,  
+	0x65,  0x5e,  0x03,  0xec,  0xc1,  0xb0,  0x44,  0xf7,  
+	0x3c,  0x72,  0xe4,  0x63,  0x51,  0xee,  0xb3,  0x8f,  
+	0x26,  0xe4,  0xaa,  0x75,  0xe6,  0xc4,  0x11,  0xe5,  
+	0xd3,  0x48,  0xbf,  0x6a,  0x19,  0xc0,  0x0b,  0x43,  
+	0x5f,  0x6c,  0x66,  0x85,  0x6a,  0x1a,  0xe5,  0xf3,  
+	0x08,  0xc9,  0x6a,  0x3d,  0x00,  0x8c,  0x35,  0x78,  
+	0x62,  0x8c,  0xaf,  0x65,  0x5e,  0x6c,  0x96,  0x05,  
+	0xc3,  0xe3,  0xf4,  0xa9,  0x57,  0x06,  0xe2,  0x80,  
+	0x74,  0xcf,  0x1e,  0x1d,  0xa7,  0x15,  0x43,  0x0a,  
+	0x9b,  0x0d,  0xc0,  0x06,  0xc8,  0x14,  0x99,  0x83,  
+	0xec,  0x63,  0x12,  0x9c,  0x9b,  0x90,  0x2b,  0xbf,  
+	0x06,  0x40,  0xc0,  0x9e,  0x21,  0xdd,  0x93,  0x73,  
+	0x84,  0x53,  0x1c,  0x7c,  0x90,  0x2b,  0x38,  0x84,  
+	0x8d,  0x03,  0x11,  0xe6,  0x38,  0xe4,  0x0a,  0xcc,  
+	0x68,  0x35,  0x92,  0x50,  0x3e,  0x4e,  0x40,  0x26,  
+	0x83,  0xd7,  0x1c,  0xad,  0xc3,  0x03,  0x82,  0x29,  
+	0x94,  0xdd,  0x90,  0x27,  0x69,  0x4d,  0xf0,  0x5b,  
+	0xfe,  0xb1,  0xa1,  0x3e,  0xf6,  0x43,  0xb6,  0x04,  
+	0xb9,  0x63,  0xc1,  0x63,  0x03,  0x64,  0xf2,  0x92,  
+	0x35,  0x15,  0xc0,  0x37,  0x01,  0x34,  0x0f,  0xe1,  
+	0x8d,  0x96,  0xde,  0x0f,  0xdd,  0x52,  0xb5,  0x05,  
+	0x41,  0x1f,  0x04,  0x8c,  0xc2,  0x6a,  0x4d,  0xc0,  
+	0xab,  0x48,  0xab,  0xa0,  0x0d,  0x19,  0x01,  0x86,  
+	0x37,  0x9e,  0xf7,  0xde,  0x0d,  0x99,  0x03,  0x02,  
+	0xc6,  0xc1,  0x20,  0x24,  0x4a,  0xd5,  0x51,  0x30,  
+	0x9d,  0xd1,  0x3d,  0x5a,  0x5c,  0x37,  0x85,  0xeb,  
+	0x02,  0x39,  0x7e,  0x16,  0xe4,  0x0e,  0xe5,  0x73,  
+	0x05,  0x64,  0xa2,  0x20,  0x74,  0x08,  0x64,  0x94,  
+	0x00,  0x2e,  0x52,  0x39,  0x22,  0x60,  0x47,  0x3a,  
+	0x91,  0xbe,  0xc8,  0xa2,  0x7c,  0x2d,  0x5b,  0xa4,  
+	0xd5,  0x00,  0x25,  0xca,  0x2b,  0x7f,  0xfc,  0x41,  
+	0x99,  0x54,  0x5d,  0x46,  0xa5,  0x80,  0x3c,  0x56,  
+	0x80,  0x2b,  0x44,  0x86,  0x51,  0xc4,  0xf7,  0xe0,  
+	0x87,  0x2f,  0x3e,  0xf8,  0x56,  0xd8,  0x3d,  0xf5,  
+	0xc5,  0x66,  0xa2,  0xc2,  0x50,  0x3c,  0x26,  0x30,  
+	0x37,  0xc9,  0x42,  0xd0,  0x54,  0x0d,  0x84,  0xf0,  
+	0xfe,  0x64,  0xaf,  0x57,  0x03,  0xcf,  0x10,  0xa9,  
+	0x02,  0x7c,  0x15,  0x4c,  0x6f,  0xd0,  0x3d,  0x62,  
+	0x80,  0x4d,  0xeb,  0xd6,  0xd7,  0xbe,  0xe5,  0xbc,  
+	0x4f,  0x21,  0xed,  0xf0,  0x1c,  0x0b,  0xe8,  0x67,  
+	0xbf,  0xbc,  0x3c,  0x40,  0x1b,  0xfa,  0xe3,  0x9f,  
+	0xff,  0x0c,  0xf2,  0x0d,  0x67,  0x3d,  0x26,  0x02,  
+	0x13,  0x34,  0x08,  0xfb,  0xdc,  0xb7,  0x10,  0x77,  
+	0x3c,  0x2c,  0x2d,  0x21,  0xc0,  0xc7,  0x41,  0x1a,  
+	0x18,  0xb3,  0x0c,  0xe6,  0x63,  0x7f,  0xe7,  0xe9,  
+	0x1f,  0x43,  0x9a,  0x01,  0x2b,  0xbd,  0x14,  0x60,  
+	0x59,  0x0b,  0xd9,  0xa0,  0x01,  0x3b,  0xe8,  0x80,  
+	0xc7,  0x70,  0x40,  0x84,  0x06,  0x21,  0xa1,  0xf3,  
+	0xaa,  0x41,  0x24,  0x43,  0xb4,  0xe1,  0x87,  0xfe,  
+	0x40,  0x0c,  0xa2,  0x10,  0x81,  0xd8,  0x87,  0xcd,  
+	0x19,  0xc4,  0x1d,  0x3d,  0x80,  0x8d,  0x0c,  0x8c,  
+	0xa8,  0xc1,  0x15,  0x3c,  0xe0,  0x89,  0x0f,  0x20,  
+	0x99,  0x01,  0xa0,  0xf8,  0x00,  0x4c,  0x2c,  0xa4,  
+	0x1d,  0x1f,  0x44,  0xcb,  0x09,  0x6a,  0xa5,  0xc3,  
+	0xb5,  0x9c,  0x6c,  0x29,  0xf9,  0xb0,  0x44,  0xd1,  
+	0xd4,  0x32,  0x80,  0x47,  0xd0,  0x8f,  0x20,  0xfb,  
+	0xb0,  0xc6,  0x33,  0xd6,  0xb8,  0x8c,  0x35,  0xa4,  
+	0xe5,  0x01,  0xa8,  0x58,  0xe3,  0x1a,  0x99,  0x48,  
+	0x90,  0x70,  0x8c,  0x91,  0x06,  0x0c,  0x24,  0x1c,  
+	0xd6,  0x6e,  0xe2,  0x8d,  0xc4,  0xed,  0x26,  0x02,  
+	0x8c,  0x83,  0x88,  0xed,  0x02,  0x80,  0x3b,  0x87,  
+	0xbc,  0xa2,  0x6a,  0x52,  0xd0,  0xc7,  0x41,  0x24,  
+	0x51,  0xb5,  0x38,  0x9c,  0xd1,  0x23,  0xee,  0x20,  
+	0xc2,  0x75,  0x86,  0xc0,  0xb2,  0x85,  0x0c,  0xb2,  
+	0x90,  0x0d,  0x71,  0x03,  0x64,  0x12,  0x81,  0x90,  
+	0x57,  0x78,  0x2e,  0x05,  0x95,  0x04,  0x89,  0x28,  
+	0xc6,  0x48,  0xb8,  0x47,  0x10,  0xeb,  0x20,  0x97,  
+	0xcc,  0xe0,  0x41,  0xdc,  0x81,  0x03,  0xc8,  0xe4,  
+	0x02,  0x21,  0xe2,  0x38,  0x94,  0x5e,  0x08,  0x70,  
+	0x8c,  0x97,  0x68,  0xc3,  0x8f,  0xd7,  0x99,  0xc0,  
+	0x80,  0xee,  0x36,  0xba,  0x87,  0x58,  0x23,  0x8b,  
+	0x67,  0x39,  0x80,  0x35,  0x10,  0x72,  0x0f,  0x75,  
+	0x3d,  0x66,  0x0b,  0x8f,  0xd4,  0x48,  0x24,  0x11,  
+	0xa4,  0x03,  0x3a,  0x1a,  0x04,  0x18,  0x65,  0x88,  
+	0x66,  0x19,  0xe0,  0xe0,  0xcc,  0x82,  0xec,  0x43,  
+	0x0e,  0x90,  0x59,  0x01,  0xdc,  0xfc,  0x51,  0x08,  
+	0xc8,  0x48,  0x60,  0x98,  0x21,  0xc9,  0x07,  0x1f,  
+	0xaa,  0x06,  0x1b,  0xa5,  0xd1,  0x6e,  0x22,  0xe0,  
+	0xa8,  0x59,  0x5e,  0xc0,  0xa0,  0x10,  0x68,  0x00,  
+	0xf3,  0x2c,  0x48,  0x38,  0x67,  0x44,  0x5c,  0xf1,  
+	0xce,  0xb3,  0xf8,  0xa0,  0x06,  0xdd,  0xfe,  0x12,  
+	0xc5,  0x29,  0x2f,  0x72,  0x0f,  0x7b,  0xa1,  0x4e,  
+	0x21,  0xf7,  0x98,  0xc1,  0xe7,  0x48,  0x01,  0x92,  
+	0x60,  0xe0,  0x52,  0x2f,  0x12,  0xa0,  0x46,  0x05,  
+	0x37,  0x23,  0x81,  0x5f,  0x80,  0xa4,  0x73,  0x90,  
+	0x61,  0xc1,  0x36,  0x05,  0x62,  0x0a,  0x72,  0x4e,  
+	0x80,  0x5e,  0x1d,  0xc1,  0x46,  0xf1,  0x3e,  0x57,  
+	0x09,  0x97,  0x80,  0x82,  0x94,  0x01,  0xb8,  0xc0,  
+	0x2e,  0x37,  0x82,  0x0d,  0x9f,  0x41,  0x4c,  0x12,  
+	0x0c,  0x69,  0x87,  0x31,  0x1f,  0x23,  0x02,  0x6c,  
+	0x70,  0x04,  0x1c,  0x2b,  0xe0,  0x0c,  0x11,  0x8c,  
+	0x73,  0x0f,  0x2b,  0x70,  0xa6,  0xa5,  0x1c,  0x09,  
+	0x07,  0xd2,  0x20,  0xe3,  0x81,  0x6a,  0x0e,  0x64,  
+	0x94,  0x9b,  0x29,  0x81,  0x33,  0x34,  0x02,  0x0d,  
+	0x14,  0x70,  0x26,  0x03,  0xc7,  0x0b,  0xc7,  0x46,  
+	0x21,  0x23,  0x82,  0x5a,  0x66,  0x04,  0x1c,  0x02,  
+	0x85,  0xcc,  0x00,  0x38,  0xe1,  0x90,  0x78,  0x24,  
+	0x71,  0x33,  0x17,  0x70,  0x85,  0x3c,  0x0b,  0xc2,  
+	0x1f,  0x0b,  0x3e,  0xc6,  0x00,  0xdc,  0x2b,  0xc8,  
+	0x2e,  0xea,  0x79,  0xbb,  0x54,  0x24,  0x13,  0x45,  
+	0xb7,  0x38,  0xdd,  0x66,  0x5e,  0xe0,  0x53,  0x82,  
+	0x40,  0x63,  0x45,  0x9b,  0x59,  0xc0,  0x18,  0xa4,  
+	0x26,  0x91,  0x75,  0xb8,  0x01,  0x73,  0xb3,  0xe4,  
+	0x83,  0xf0,  0xf2,  0x41,  0x09,  0x90,  0x06,  0xc0,  
+	0x00,  0x73,  0x6d,  0xda,  0x1d,  0x64,  0x09,  0x99,  
+	0x03,  0xc0,  0xb0,  0x21,  0x2e,  0xf3,  0x6b,  0x00,  
+	0x40,  0xc0,  0x07,  0x73,  0x9c,  0x75,  0x20,  0xf9,  
+	0x68,  0x87,  0x26,  0x9e,  0xc6,  0x99,  0x95,  0x11,  
+	0x73,  0x0c,  0xe4,  0x44,  0x8b,  0x08,  0x2a,  0xc1,  
+	0x8e,  0x7d,  0x12,  0x24,  0x1f,  0xeb,  0x78,  0xc4,  
+	0x52,  0xa5,  0x9a,  0x87,  0xc7,  0x5a,  0x0a,  0x0b,  
+	0xbb,  0x19,  0xc0,  0x04,  0xc6,  0x70,  0x0b,  0x72,  
+	0x28,  0x12,  0x2c,  0xeb,  0x00,  0xfe,  0xc6,  0x22,  
+	0x3e,  0x90,  0x59,  0xb4,  0x10,  0xa1,  0x9a,  0xeb,  
+	0x40,  0x42,  0x6a,  0x37,  0x70,  0x08,  0x60,  0x00,  
+	0x06,  0x21,  0xfb,  0x28,  0xc7,  0x2d,  0xd6,  0x60,  
+	0x81,  0xda,  0x9e,  0x25,  0x0a,  0x13,  0x4d,  0x88,  
+	0x39,  0xfa,  0x86,  0xa8,  0x0a,  0xac,  0xc0,  0x09,  
+	0x6d,  0x30,  0x44,  0x25,  0xa6,  0x6b,  0x08,  0x31,  
+	0xe4,  0xa0,  0x03,  0x84,  0x55,  0xe2,  0x38,  0x18,  
+	0x22,  0x37,  0xe6,  0x18,  0xa0,  0x03,  0x35,  0x00,  
+	0x83,  0x20,  0xa6,  0x5b,  0x09,  0x43,  0xcc,  0x01,  
+	0x0a,  0x31,  0xc0,  0x80,  0xe7,  0xf4,  0xc2,  0x82,  
+	0x70,  0x54,  0x64,  0x1c,  0x32,  0x60,  0x11,  0x7c,  
+	0x66,  0xa0,  0xca,  0x82,  0x94,  0x03,  0x9f,  0xf2,  
+	0xbd,  0x0e,  0x0a,  0xea,  0xdb,  0x10,  0x71,  0xcc,  
+	0x2d,  0xbf,  0xbb,  0x91,  0x01,  0x7f,  0xed,  0x5b,  
+	0x1e,  0x00,  0xc3,  0x86,  0x05,  0x2e,  0xc5,  0xc8,  
+	0x3a,  0xa2,  0x60,  0x5c,  0x16,  0x0d,  0x20,  0x0a,  
+	0xe6,  0xc3,  0x49,  0x17,  0x1a,  0xcc,  0x22,  0x22,  
+	0xb8,  0x57,  0x99,  0x7d,  0xc8,  0xae,  0x81,  0xcf,  
+	0xd2,  0x00,  0x3b,  0x84,  0xb2,  0x21,  0xf1,  0x48,  
+	0x44,  0x0b,  0x37,  0xbc,  0x17,  0x39,  0xb4,  0x35,  
+	0x64,  0xbc,  0x48,  0x01,  0x85,  0x6b,  0xf4,  0x81,  
+	0x5b,  0x98,  0x36,  0x21,  0x17,  0x42,  0xc1,  0x8a,  
+	0xe3,  0x53,  0x02,  0x57,  0xbc,  0xb8,  0xae,  0x89,  
+	0x18,  0x1c,  0x80,  0x25,  0x90,  0x87,  0x08,  0x5b,  
+	0x64,  0x1d,  0x7c,  0x38,  0x28,  0x8b,  0x2a,  0xc0,  
+	0x87,  0x13,  0x5f,  0x64,  0x1c,  0x72,  0xe8,  0xc0,  
+	0x8c,  0x11,  0xda,  0x05,  0x70,  0xdc,  0xb8,  0x21,  
+	0xfb,  0xf0,  0xc6,  0x18,  0x84,  0x0c,  0x9f,  0x01,  
+	0x74,  0x80,  0x0d,  0xdf,  0xf0,  0x2c,  0x47,  0xc8,  
+	0x51,  0x0a,  0x1f,  0x2c,  0x60,  0xc9,  0x05,  0xf8,  
+	0x00,  0x1f,  0xb0,  0xa1,  0x65,  0x8a,  0xe4,  0x03,  
+	0x1c,  0x8f,  0x28,  0xc1,  0xfe,  0x93,  0xe2,  0xb3,  
+	0x00,  0x1b,  0x80,  0x82,  0x1c,  0x5f,  0xa9,  0x0f,  
+	0x38,  0x36,  0x41,  0x06,  0x16,  0x54,  0x80,  0x94,  
+	0x07,  0x10,  0xc1,  0x13,  0xf8,  0x00,  0x0c,  0x77,  
+	0x94,  0xf9,  0x22,  0xf9,  0xb8,  0xc7,  0x32,  0xfc,  
+	0x40,  0x85,  0x12,  0x1c,  0xa0,  0x6a,  0x04,  0x98,  
+	0x00,  0x0b,  0xc8,  0x90,  0x09,  0x6d,  0x6c,  0xf5,  
+	0x23,  0xfb,  0x60,  0x87,  0x39,  0xbe,  0x01,  0x8c,  
+	0x56,  0x8c,  0x62,  0x13,  0x98,  0xde,  0xc4,  0x2d,  
+	0xb2,  0x51,  0x8e,  0x75,  0x3c,  0xfa,  0x75,  0xeb,  
+	0x28,  0x47,  0x36,  0x6e,  0x91,  0x69,  0x4c,  0xb7,  
+	0x02,  0x18,  0xde,  0x30,  0x47,  0x67,  0xe3,  0xcc,  
+	0xea,  0x56,  0xbb,  0xfa,  0xd5,  0xb0,  0x8e,  0xb5,  
+	0xac,  0x67,  0x4d,  0xeb,  0x5a,  0x4f,  0x44,  0x63,  
+	0x16,  0x01,  0x47,  0x30,  0x76,  0x1d,  0x8c,  0x66,  
+	0x08,  0x4f,  0xd7,  0xbc,  0xfe,  0x05,  0x35,  0xae,  
+	0xc1,  0x69,  0xc0,  0xad,  0x83,  0xd7,  0xbb,  0x6e,  
+	0xc6,  0x35,  0xae,  0xe1,  0x8d,  0x4a,  0xba,  0x23,  
+	0x19,  0xbb,  0xa6,  0x86,  0x41,  0xbc,  0xb1,  0xeb,  
+	0x64,  0xd8,  0xad,  0x1d,  0xbf,  0xc8,  0xb6,  0xb6,  
+	0xb7,  0x9d,  0x6d,  0xa9,  0xb9,  0x03,  0xd9,  0x10,  
+	0x44,  0x17,  0xb4,  0x7f,  0xe1,  0x63,  0x77,  0x50,  
+	0xe3,  0x11,  0x55,  0xa8,  0x82,  0x20,  0x80,  0xb1,  
+	0xdd,  0x88,  0x14,  0xd3,  0x47,  0x3e,  0xfa,  0xa6,  
+	0x41,  0xb4,  0x00,  0x6f,  0x1f,  0x11,  0x80,  0x00,  
+	0x06,  0xd8,  0x40,  0x16,  0x9a,  0xa1,  0x14,  0x60,  
+	0x1c,  0x1a,  0xde,  0xf7,  0x4e,  0x74,  0x0f,  0x12,  
+	0xc1,  0x2b,  0x69,  0xf4,  0x88,  0x00,  0x44,  0xc8,  
+	0x56,  0x3e,  0xd8,  0x40,  0x80,  0x01,  0x14,  0x00,  
+	0x14,  0x02,  0xf1,  0x45,  0x01,  0x04,  0x40,  0xf1,  
+	0x8a,  0x5b,  0x9c,  0x00,  0x90,  0x10,  0x48,  0x38,  
+	0x0c,  0x00,  0xef,  0x0d,  0xb4,  0x83,  0x20,  0xac,  
+	0xe8,  0x51,  0x01,  0xfe,  0x46,  0x01,  0x59,  0x57,  
+	0xe4,  0xa0,  0x5f,  0x03,  0xc8,  0xc0,  0x23,  0x3e,  
+	0x8c,  0x10,  0x6c,  0x70,  0x0b,  0x2d,  0x03,  0x80,  
+	0x78,  0x41,  0x50,  0x0b,  0x99,  0x08,  0x84,  0xd5,  
+	0x1f,  0xc0,  0x58,  0xef,  0x00,  0x4a,  0x10,  0x48,  
+	0x7f,  0x48,  0x63,  0x53,  0x09,  0xff,  0x2c,  0x1b,  
+	0xce,  0x32,  0xd5,  0x88,  0x67,  0x76,  0x00,  0x6a,  
+	0xf3,  0x87,  0x1d,  0xd1,  0x12,  0x25,  0x90,  0x3b,  
+	0x66,  0x00,  0x24,  0xf7,  0x47,  0x3e,  0x40,  0xf1,  
+	0x4e,  0x02,  0x7c,  0x81,  0xe5,  0x06,  0x61,  0xa4,  
+	0x5a,  0x06,  0x48,  0x10,  0x9a,  0xef,  0x25,  0x03,  
+	0x0e,  0xe0,  0x38,  0x5a,  0x32,  0x20,  0xb5,  0x9c,  
+	0x13,  0x1d,  0x02,  0x0c,  0x38,  0x80,  0xb5,  0x36,  
+	0x90,  0xe0,  0x9f,  0x9f,  0x25,  0xe8,  0x90,  0x1d,  
+	0x7a,  0x67,  0xa8,  0xea,  0x8f,  0x64,  0x84,  0xe0,  
+	0x03,  0x54,  0x81,  0xb9,  0x50,  0x3e,  0x10,  0x82,  
+	0x53,  0x68,  0xdc,  0x5a,  0x2c,  0x28,  0x15,  0x2b,  
+	0x9e,  0x1e,  0xf5,  0x5b,  0x54,  0xc9,  0x00,  0x19,  
+	0xb8,  0x40,  0xbc,  0x0a,  0x70,  0x09,  0x87,  0xd4,  
+	0xb4,  0x39,  0x22,  0x9a,  0xc0,  0xc7,  0xbb,  0x8e,  
+	0x16,  0x44,  0x98,  0xc3,  0x1c,  0xe1,  0xb0,  0xc3,  
+	0x91,  0x06,  0x60,  0x0a,  0xd1,  0x98,  0x3d,  0x00,  
+	0x23,  0x08,  0xc7,  0xe5,  0xa1,  0x51,  0x2d,  0xb4,  
+	0x0c,  0xd0,  0xed,  0x01,  0x80,  0xbb,  0x40,  0x16,  
+	0x4e,  0x74,  0xba,  0xdf,  0x63,  0x1d,  0xb0,  0xa7,  
+	0x06,  0x5e,  0x24,  0xb0,  0x0c,  0xd8,  0x7b,  0xfa,  
+	0xef,  0xc0,  0x4a,  0xc5,  0x40,  0x06,  0xdf,  0x19,  
+	0x92,  0xbb,  0x63,  0xa5,  0x39,  0xe8,  0xca,  0x3a,  
+	0x92,  0xb1,  0x52,  0x11,  0xf8,  0x18,  0x21,  0xeb,  
+	0xa8,  0x61,  0x00,  0x28,  0xb0,  0x81,  0xe6,  0xe8,  
+	0x9e,  0xf2,  0x67,  0xd9,  0xc4,  0x40,  0xee,  0x41,  
+	0x03,  0xb4,  0x70,  0x41,  0x20,  0x9f,  0x67,  0x81,  
+	0x87,  0xee,  0xfe,  0x91,  0x86,  0xd7,  0x1c,  0x00,  
+	0x82,  0xa8,  0x57,  0xbd,  0xd4,  0xe5,  0x5e,  0xf4,  
+	0x82,  0x98,  0x03,  0x2f,  0x98,  0xc4,  0x7d,  0x5a,  
+	0x58,  0x00,  0x30,  0xde,  0x43,  0xdd,  0x1f,  0x67,  
+	0x3b,  0x8b,  0x05,  0x8e,  0x17,  0x8d,  0x97,  0x13,  
+	0xe0,  0x16,  0x0d,  0x69,  0xc5,  0xa6,  0xfa,  0xe0,  
+	0x07,  0xb4,  0x6c,  0x21,  0x30,  0x5e,  0x27,  0x7d,  
+	0x03,  0xa1,  0x5b,  0x67,  0x51,  0x05,  0xd8,  0x27,  
+	0x22,  0xda,  0x47,  0x10,  0xe5,  0x60,  0x41,  0x7d,  
+	0xe0,  0x73,  0x40,  0xa7,  0x70,  0xe4,  0x47,  0x77,  
+	0xe8,  0x82,  0x7e,  0xfe,  0xb3,  0x74,  0x7f,  0x75,  
+	0x16,  0xdb,  0x23,  0x10,  0xee,  0x37,  0x0a,  0xf9,  
+	0x30,  0x06,  0x68,  0xc1,  0x06,  0x81,  0x91,  0x0f,  
+	0x51,  0x80,  0x16,  0xd7,  0xc3,  0x10,  0x23,  0x18,  
+	0x00,  0x05,  0x00,  0x0d,  0xbf,  0x20,  0x22,  0xc6,  
+	0x07,  0x7d,  0x01,  0x20,  0x80,  0x87,  0x61,  0x4c,  
+	0xef,  0x87,  0x73,  0x08,  0x08,  0x23,  0xfb,  0x50,  
+	0x04,  0xb6,  0xe5,  0x80,  0x6f,  0x07,  0x81,  0xad,  
+	0x67,  0x10,  0xe7,  0x77,  0x3b,  0x15,  0xb8,  0x29,  
+	0x36,  0x20,  0x22,  0x3e,  0x10,  0x17,  0x1b,  0xe8,  
+	0x0e,  0x1f,  0x40,  0x74,  0x30,  0x38,  0x10,  0x7d,  
+	0xa0,  0x45,  0x13,  0x63,  0x0e,  0x1b,  0x55,  0x02,  
+	0xeb,  0x00,  0x85,  0xcd,  0x81,  0x51,  0x02,  0xe1,  
+	0x75,  0x86,  0x30,  0x85,  0xba,  0x60,  0x05,  0xaf,  
+	0xb1,  0x01,  0xed,  0x96,  0x7d,  0x43,  0x62,  0x08,  
+	0x68,  0xc1,  0x03,  0xfa,  0x10,  0x7e,  0x3c,  0x38,  
+	0x77,  0x3e,  0x48,  0x81,  0x06,  0x61,  0x81,  0x82,  
+	0x60,  0x03,  0x67,  0x61,  0x00,  0xbb,  0xe0,  0x0f,  
+	0x47,  0x08,  0x01,  0x6f,  0x38,  0x0c,  0x06,  0xf1,  
+	0x0a,  0x9b,  0xb2,  0x01,  0x38,  0x94,  0x10,  0x2b,  
+	0x78,  0x16,  0x5a,  0x20,  0x10,  0x04,  0x18,  0x00,  
+	0x6c,  0xe0,  0x82,  0x0c,  0xb0,  0x01,  0x17,  0x70,  
+	0x31,  0xfe,  0x16,  0xc0,  0x0a,  0x03,  0x01,  0x86,  
+	0x05,  0xd1,  0x0a,  0xaf,  0x31,  0x03,  0xf1,  0x60,  
+	0x86,  0x42,  0xd7,  0x83,  0xe6,  0xa7,  0x86,  0x05,  
+	0x61,  0x81,  0x97,  0x10,  0x7f,  0x01,  0x30,  0x3b,  
+	0x47,  0xc8,  0x00,  0x67,  0x81,  0x41,  0x06,  0xb1,  
+	0x0c,  0x47,  0x92,  0x01,  0x7b,  0x08,  0x16,  0x74,  
+	0x40,  0x74,  0xcf,  0x97,  0x0a,  0xaf,  0x81,  0x02,  
+	0x1e,  0xe2,  0x75,  0x6a,  0x71,  0x00,  0x4e,  0x10,  
+	0x6e,  0x07,  0x78,  0x16,  0x09,  0x48,  0x10,  0x54,  
+	0x73,  0x16,  0x32,  0x10,  0x89,  0x0f,  0x38,  0x89,  
+	0x68,  0x58,  0x89,  0x40,  0xb8,  0x86,  0x9b,  0x72,  
+	0x09,  0xec,  0x60,  0x4c,  0x07,  0x40,  0x0d,  0x1b,  
+	0xc8,  0x0e,  0x78,  0xc1,  0x00,  0xfe,  0xf3,  0x4b,  
+	0x67,  0x71,  0x01,  0xa5,  0xf8,  0x3f,  0x21,  0x70,  
+	0x16,  0x0c,  0xb0,  0x1e,  0xe5,  0x80,  0x17,  0x32,  
+	0x33,  0x10,  0x5e,  0x67,  0x00,  0x62,  0x87,  0x82,  
+	0x68,  0xb2,  0x88,  0x35,  0x58,  0x10,  0xa2,  0x30,  
+	0x86,  0xf9,  0x20,  0x89,  0x71,  0x47,  0x89,  0x13,  
+	0xf8,  0x8b,  0x97,  0x18,  0x8c,  0xfe,  0x80,  0x0a,  
+	0xaf,  0x31,  0x05,  0xa5,  0x40,  0x78,  0xee,  0x00,  
+	0x57,  0x07,  0x90,  0x60,  0x04,  0x21,  0x8a,  0x67,  
+	0xa1,  0x87,  0x0a,  0x81,  0x0c,  0x78,  0x71,  0x02,  
+	0xd4,  0x20,  0x0e,  0xe2,  0x50,  0x54,  0x68,  0x61,  
+	0x09,  0xd8,  0x88,  0x16,  0x76,  0x00,  0x0c,  0x6e,  
+	0x70,  0x24,  0x05,  0xd0,  0x2a,  0xde,  0x48,  0x8b,  
+	0x36,  0x98,  0x32,  0x6f,  0xa7,  0x83,  0xa9,  0x77,  
+	0x86,  0xe5,  0x77,  0x8e,  0x84,  0x14,  0x84,  0x67,  
+	0xd1,  0x78,  0xeb,  0x60,  0x54,  0x84,  0xe4,  0x04,  
+	0xf0,  0x88,  0x27,  0x04,  0x80,  0x0b,  0x06,  0x71,  
+	0x0a,  0xaf,  0xf1,  0x01,  0xcf,  0x58,  0x10,  0x8e,  
+	0xb0,  0x16,  0x15,  0x60,  0x01,  0x16,  0x50,  0x01,  
+	0xf1,  0x52,  0x84,  0x57,  0x88,  0x16,  0xd2,  0x77,  
+	0xfe,  0x0f,  0x98,  0x75,  0x16,  0x29,  0xb0,  0x1d,  
+	0x8c,  0x38,  0x7d,  0x1a,  0x19,  0x00,  0x76,  0x00,  
+	0x91,  0x44,  0xc0,  0x55,  0x1e,  0xd8,  0x19,  0x04,  
+	0xe5,  0x8b,  0x15,  0x09,  0x8c,  0x17,  0x29,  0x10,  
+	0x85,  0xf0,  0x1a,  0x9e,  0xd8,  0x7b,  0xee,  0x30,  
+	0x02,  0x44,  0xf7,  0x08,  0x06,  0xe1,  0x46,  0x67,  
+	0x31,  0x04,  0xaf,  0xb5,  0x4a,  0x42,  0x00,  0x1b,  
+	0x07,  0x20,  0x35,  0x01,  0xa8,  0x71,  0x1e,  0xa9,  
+	0x09,  0x0b,  0x19,  0x00,  0xb5,  0x28,  0x10,  0xae,  
+	0x70,  0x24,  0x06,  0xe0,  0x52,  0xd4,  0xb0,  0x29,  
+	0x37,  0xa0,  0x1a,  0xee,  0x50,  0x95,  0x7f,  0x85,  
+	0x7f,  0x42,  0x99,  0x7e,  0x4a,  0xa7,  0x8e,  0xfe,  
+	0x60,  0x0e,  0x5e,  0xd5,  0x7b,  0x1d,  0x68,  0x7a,  
+	0x30,  0xc2,  0x0e,  0x39,  0x40,  0x74,  0x41,  0x89,  
+	0x10,  0xd5,  0x48,  0x74,  0x05,  0xf0,  0x97,  0x80,  
+	0xf9,  0x1a,  0x03,  0xd0,  0x78,  0xfe,  0x90,  0x95,  
+	0x52,  0xf7,  0x93,  0x5e,  0xb9,  0x1e,  0x37,  0x99,  
+	0x0f,  0xbf,  0x60,  0x41,  0x48,  0x60,  0x18,  0xe9,  
+	0x74,  0x16,  0xf3,  0x42,  0x10,  0xde,  0x80,  0x17,  
+	0x17,  0x60,  0x44,  0x3f,  0x38,  0x94,  0xe9,  0x58,  
+	0x94,  0xfe,  0xb0,  0x0f,  0x89,  0x40,  0x46,  0x24,  
+	0xe7,  0x0a,  0x9b,  0x62,  0x00,  0xba,  0xc0,  0x28,  
+	0xa2,  0x20,  0x22,  0xf3,  0xa7,  0x10,  0x9b,  0xf0,  
+	0x1a,  0x65,  0x00,  0x0e,  0xde,  0xf0,  0x9a,  0xde,  
+	0xa0,  0x0d,  0x50,  0x80,  0x16,  0x56,  0x20,  0x1a,  
+	0x86,  0x59,  0x77,  0x10,  0xc2,  0x79,  0x9e,  0x27,  
+	0x22,  0x19,  0x90,  0x0a,  0xa8,  0xd0,  0x07,  0x51,  
+	0x00,  0x2b,  0x15,  0x80,  0x0c,  0x02,  0x71,  0x0f,  
+	0x43,  0x80,  0x16,  0x32,  0xa0,  0x0c,  0xed,  0xd0,  
+	0x0e,  0xda,  0x70,  0x9c,  0x7e,  0x68,  0x13,  0xeb,  
+	0xb0,  0x0b,  0xd2,  0x69,  0x0a,  0x47,  0x52,  0x45,  
+	0xd2,  0xb9,  0x0b,  0x52,  0x83,  0x89,  0x03,  0xfe,  
+	0x01,  0x0e,  0x07,  0xf5,  0x7e,  0x19,  0xf9,  0x38,  
+	0x72,  0x00,  0x0c,  0xc0,  0x30,  0x06,  0x84,  0x35,  
+	0x06,  0xa7,  0x94,  0x0f,  0x92,  0x64,  0x35,  0x56,  
+	0xc8,  0x1d,  0xaf,  0x71,  0x01,  0xdb,  0x75,  0x9b,  
+	0xf9,  0x80,  0x83,  0x67,  0x81,  0x02,  0x5e,  0xf1,  
+	0x79,  0x9d,  0xf1,  0x23,  0x16,  0xf0,  0x7c,  0x02,  
+	0xd1,  0x0a,  0x17,  0x63,  0x00,  0x0e,  0xe0,  0x00,  
+	0x07,  0x00,  0x00,  0xf7,  0x48,  0x3a,  0x12,  0x47,  
+	0x71,  0xd6,  0x52,  0x71,  0x05,  0x10,  0x09,  0xea,  
+	0x47,  0x98,  0x02,  0x11,  0x40,  0x30,  0x17,  0x75,  
+	0x61,  0x99,  0x16,  0x7f,  0xb9,  0x7e,  0xc7,  0x47,  
+	0x10,  0xe2,  0xe0,  0x2c,  0x2d,  0x58,  0x10,  0xda,  
+	0xe0,  0x91,  0xa9,  0x73,  0x9b,  0x34,  0xd8,  0x1c,  
+	0xea,  0x63,  0x9f,  0x25,  0x33,  0x04,  0x87,  0x15,  
+	0x30,  0x7e,  0xf0,  0x4e,  0x19,  0xf0,  0x0a,  0x04,  
+	0xe1,  0x0b,  0x47,  0x97,  0x74,  0xda,  0x39,  0x10,  
+	0xd9,  0x00,  0x57,  0xbd,  0xb7,  0x7a,  0x9a,  0x00,  
+	0x4c,  0x03,  0x70,  0x03,  0xd2,  0xa6,  0x10,  0xc9,  
+	0x20,  0x02,  0x1e,  0xe0,  0x01,  0x63,  0x70,  0x10,  
+	0x22,  0xd8,  0xa3,  0x1e,  0x00,  0x07,  0xfb,  0xd0,  
+	0x06,  0x42,  0xaa,  0x9f,  0xfe,  0xc0,  0x0e,  0x51,  
+	0x20,  0xa4,  0xf1,  0xc4,  0x0c,  0x3c,  0x2a,  0xa4,  
+	0x1e,  0x90,  0x02,  0x44,  0x20,  0x06,  0xd0,  0x10,  
+	0x4a,  0xc6,  0x32,  0x04,  0x2c,  0x79,  0x6f,  0x06,  
+	0x00,  0x02,  0x4d,  0x56,  0x10,  0xc1,  0x00,  0x02,  
+	0x1d,  0x10,  0xa6,  0x62,  0x3a,  0xa6,  0x1e,  0x20,  
+	0x80,  0xe3,  0xf0,  0xa4,  0x51,  0x57,  0x9c,  0x63,  
+	0x20,  0xa4,  0x20,  0xd0,  0x0a,  0x8c,  0x02,  0x0c,  
+	0x44,  0x60,  0x01,  0x05,  0x70,  0x6f,  0x07,  0x20,  
+	0x03,  0x7b,  0xd0,  0x56,  0xee,  0x70,  0x79,  0xaa,  
+	0x86,  0x7c,  0x7a,  0xea,  0x15,  0x92,  0x76,  0x79,  
+	0x00,  0x33,  0x10,  0x53,  0xa8,  0xa7,  0x3f,  0xfb,  
+	0x30,  0x17,  0x7a,  0x7a,  0x79,  0xbf,  0xb5,  0x10,  
+	0x97,  0x02,  0x6d,  0xc1,  0x00,  0x0d,  0x8e,  0xf5,  
+	0x3f,  0x87,  0x1a,  0xa9,  0x7a,  0x0a,  0x30,  0xf9,  
+	0x30,  0xa9,  0x05,  0xf1,  0xa7,  0x97,  0x37,  0x24,  
+	0x67,  0x06,  0x6d,  0xc9,  0x40,  0x0d,  0x81,  0x6a,  
+	0x6b,  0xa0,  0x1a,  0xaa,  0xa2,  0x3a,  0xaa,  0xa4,  
+	0x5a,  0xaa,  0xa6,  0x7a,  0xaa,  0xa8,  0x9a,  0xaa,  
+	0xaa,  0xba,  0xaa,  0x16,  0x11,  0x10,  0x00,  0x3b,  
+
+};
+
+const PackedEntry site_index[] PROGMEM = {
+	{0x2fbb0919UL, 12, 494, 4194, 0xe3f39051UL, 6, 0x01},		// /logo.gif
+	{0x457c5a71UL, 0, 22, 472, 0xee7b0611UL, 1, 0x00},		// /index.html
+};
+
+const PackedImage site PROGMEM = {site_data, site_index, 2};
@@ -95,9 +95,11 @@ const byte index_html[] PROGMEM = {
 
 const unsigned int index_html_len PROGMEM = 715;
 
+const uint32_t index_html_etag PROGMEM = 0xc3776404UL;
+
 /*** CODE TO INCLUDE IN SKETCH ***
 
-const Page page01 PROGMEM = {index_html_name, index_html, index_html_len, NULL};
+const Page page01 PROGMEM = {index_html_name, index_html, index_html_len, index_html_etag};
 
 const Page* const pages[] PROGMEM = {
 	&page01,
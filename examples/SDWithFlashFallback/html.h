@@ -87,9 +87,11 @@ const byte index_htm[] PROGMEM = {
 
 const unsigned int index_htm_len PROGMEM = 655;
 
+const uint32_t index_htm_etag PROGMEM = 0x7843c2fcUL;
+
 /*** CODE TO INCLUDE IN SKETCH ***
 
-const Page page01 PROGMEM = {index_htm_name, index_htm, index_htm_len, NULL};
+const Page page01 PROGMEM = {index_htm_name, index_htm, index_htm_len, index_htm_etag};
 
 const Page* const pages[] PROGMEM = {
 	&page01,
@@ -70,8 +70,8 @@ FlashStorage flashStorage;
 
 #include "html.h"
 
-const Page page01 PROGMEM = {index_html_name, index_html, index_html_len};
-const Page page02 PROGMEM = {logo_gif_name, logo_gif, logo_gif_len};
+const Page page01 PROGMEM = {index_html_name, index_html, index_html_len, index_html_etag};
+const Page page02 PROGMEM = {logo_gif_name, logo_gif, logo_gif_len, logo_gif_etag};
 
 const Page* const pages[] PROGMEM = {
 	&page01,
@@ -65,6 +65,8 @@ const byte index_html[] PROGMEM = {
 
 const unsigned int index_html_len PROGMEM = 472;
 
+const uint32_t index_html_etag PROGMEM = 0xee7b0611UL;
+
 const char logo_gif_name[] PROGMEM = "/logo.gif";
 
 const byte logo_gif[] PROGMEM = {
@@ -597,10 +599,12 @@ const byte logo_gif[] PROGMEM = {
 
 const unsigned int logo_gif_len PROGMEM = 4194;
 
+const uint32_t logo_gif_etag PROGMEM = 0xe3f39051UL;
+
 /*** CODE TO INCLUDE IN SKETCH ***
 
-const Page page01 PROGMEM = {index_html_name, index_html, index_html_len, NULL};
-const Page page02 PROGMEM = {logo_gif_name, logo_gif, logo_gif_len, NULL};
+const Page page01 PROGMEM = {index_html_name, index_html, index_html_len, index_html_etag};
+const Page page02 PROGMEM = {logo_gif_name, logo_gif, logo_gif_len, logo_gif_etag};
 
 const Page* const pages[] PROGMEM = {
 	&page01,
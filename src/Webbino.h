@@ -21,5 +21,14 @@
 #include "WebbinoCore/WebServer.h"
 
 #include "WebbinoCore/FlashStorage.h"
+#include "WebbinoCore/PackedFlashStorage.h"
+#include "WebbinoCore/MappedStorage.h"
 #include "WebbinoCore/SdStorage.h"
 #include "WebbinoCore/SpiffsStorage.h"
+#include "WebbinoCore/LittleFsStorage.h"
+#include "WebbinoCore/HostStorage.h"
+#include "WebbinoCore/GeneratorStorage.h"
+#include "WebbinoCore/CachingStorage.h"
+
+#include "WebbinoCore/Json.h"
+#include "WebbinoCore/EventStream.h"
@@ -0,0 +1,297 @@
+/***************************************************************************
+ *   This file is part of Webbino                                          *
+ *                                                                         *
+ *   Copyright (C) 2012-2019 by SukkoPera                                  *
+ *                                                                         *
+ *   Webbino is free software: you can redistribute it and/or modify       *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation, either version 3 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   Webbino is distributed in the hope that it will be useful,            *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with Webbino. If not, see <http://www.gnu.org/licenses/>.       *
+ ***************************************************************************/
+
+#ifndef CACHINGSTORAGE_H_INCLUDED
+#define CACHINGSTORAGE_H_INCLUDED
+
+#include <Arduino.h>
+#include "Storage.h"
+#include "Content.h"
+#include "Hash.h"
+#include "webbino_common.h"
+
+struct CacheSlot {
+	uint32_t nameHash;
+	uint32_t etag;
+	unsigned long size;
+	unsigned long lastUse;		// 0 means the slot is free
+	boolean valid;				// True once the whole file has been copied
+	byte data[CACHE_SLOT_SIZE];
+};
+
+/* Wraps the content returned by the cached storage. On a hit, data comes
+ * straight from the slot. On a miss, it comes from the wrapped content and is
+ * copied to the slot (if any) on the way, so that the next request for the same
+ * file will be a hit.
+ */
+class CachedContent: public Content {
+private:
+	Content* inner;
+	CacheSlot* slot;
+	unsigned long pos;
+	boolean filling;
+
+	void abortFill () {
+		DPRINTLN (F("Cache fill aborted"));
+		slot -> lastUse = 0;
+		slot = nullptr;
+		filling = false;
+	}
+
+	void tee (const byte *buf, size_t n) {
+		if (pos + n <= slot -> size) {
+			memcpy (slot -> data + pos, buf, n);
+			if (pos + n == slot -> size) {
+				// Got it all
+				slot -> valid = true;
+				slot = nullptr;
+				filling = false;
+			}
+		} else {
+			// File grew while we were reading it
+			abortFill ();
+		}
+	}
+
+	boolean isHit () const {
+		return slot && !filling;
+	}
+
+	friend class CachingStorage;
+
+public:
+	CachedContent (): inner (nullptr), slot (nullptr), pos (0), filling (false) {
+	}
+
+	CachedContent (Content& c, CacheSlot* s, boolean fill): inner (&c), slot (s),
+		pos (0), filling (fill) {
+	}
+
+	const char* getFilename () const override {
+		return inner ? inner -> getFilename () : nullptr;
+	}
+
+	boolean available () override {
+		boolean ret;
+
+		if (isHit ())
+			ret = pos < slot -> size;
+		else
+			ret = inner && inner -> available ();
+
+		return ret;
+	}
+
+	byte getNextByte () override {
+		byte b;
+
+		if (isHit ()) {
+			b = slot -> data[pos];
+		} else {
+			b = inner -> getNextByte ();
+			if (filling)
+				tee (&b, 1);
+		}
+		++pos;
+
+		return b;
+	}
+
+	size_t read (byte *buf, size_t len) override {
+		size_t n;
+
+		if (isHit ()) {
+			n = slot -> size - pos;
+			if (len < n)
+				n = len;
+
+			memcpy (buf, slot -> data + pos, n);
+		} else {
+			n = inner ? inner -> read (buf, len) : 0;
+			if (filling)
+				tee (buf, n);
+		}
+		pos += n;
+
+		return n;
+	}
+
+	uint32_t getETag () override {
+		uint32_t etag = 0;
+
+		if (isHit ())
+			etag = slot -> etag;
+		else if (inner)
+			etag = inner -> getETag ();
+
+		return etag;
+	}
+
+	unsigned long getSize () override {
+		unsigned long size = UNKNOWN_SIZE;
+
+		if (isHit ())
+			size = slot -> size;
+		else if (inner)
+			size = inner -> getSize ();
+
+		return size;
+	}
+
+	boolean seek (unsigned long newPos) override {
+		boolean ret = false;
+
+		if (isHit ()) {
+			if (newPos <= slot -> size) {
+				pos = newPos;
+				ret = true;
+			}
+		} else if (inner && inner -> seek (newPos)) {
+			// We can only fill the slot sequentially
+			if (filling && newPos != pos)
+				abortFill ();
+
+			pos = newPos;
+			ret = true;
+		}
+
+		return ret;
+	}
+};
+
+/******************************************************************************/
+
+
+/* Keeps small, frequently requested files from another storage in RAM, which
+ * mostly makes sense for storages on slow media, such as SD cards. Files are
+ * still opened on the wrapped storage at every request, but only to check that
+ * they have not changed since they were cached (i.e.: that they still have the
+ * same size and ETag), their data is then served from RAM. When no slot is
+ * free, the least recently used one is recycled.
+ *
+ * Note that with the SD library only the size can be checked, as it gives no
+ * access to timestamps. Use SdFat if your files might change while the sketch
+ * is running.
+ *
+ * Usage:
+ *   SdStorage sd;
+ *   CachingStorage cachedSd (sd);
+ *   ...
+ *   webserver.addStorage (cachedSd);
+ */
+class CachingStorage: public Storage {
+private:
+	Storage& backend;
+	CacheSlot slots[CACHE_SLOTS];
+	unsigned long useCounter;
+	CachedContent content;
+
+	CacheSlot* findSlot (uint32_t hash) {
+		CacheSlot* ret = nullptr;
+
+		for (byte i = 0; !ret && i < CACHE_SLOTS; ++i) {
+			if (slots[i].lastUse != 0 && slots[i].nameHash == hash)
+				ret = &slots[i];
+		}
+
+		return ret;
+	}
+
+	// Returns a free slot, or the least recently used one
+	CacheSlot* getVictim () {
+		CacheSlot* ret = &slots[0];
+
+		for (byte i = 1; ret -> lastUse != 0 && i < CACHE_SLOTS; ++i) {
+			if (slots[i].lastUse < ret -> lastUse)
+				ret = &slots[i];
+		}
+
+		return ret;
+	}
+
+public:
+	CachingStorage (Storage& _backend): backend (_backend), useCounter (0) {
+		for (byte i = 0; i < CACHE_SLOTS; ++i)
+			slots[i].lastUse = 0;
+	}
+
+	boolean exists (const char* filename) override {
+		return backend.exists (filename);
+	}
+
+	Content& get (const char* filename) override {
+		Content& c = backend.get (filename);
+		const uint32_t hash = fnv1a (FNV_OFFSET_BASIS, filename, strlen (filename));
+		const uint32_t etag = c.getETag ();
+		const unsigned long size = c.getSize ();
+
+		CacheSlot* slot = findSlot (hash);
+		if (slot && slot -> valid && slot -> size == size && slot -> etag == etag) {
+			DPRINT (F("Cache hit for "));
+			DPRINTLN (filename);
+
+			slot -> lastUse = ++useCounter;
+			content = CachedContent (c, slot, false);
+		} else {
+			if (slot) {
+				// Stale or half-filled, drop it
+				slot -> lastUse = 0;
+			}
+
+			if (size > 0 && size <= CACHE_SLOT_SIZE) {
+				DPRINT (F("Caching "));
+				DPRINTLN (filename);
+
+				slot = getVictim ();
+				slot -> nameHash = hash;
+				slot -> etag = etag;
+				slot -> size = size;
+				slot -> valid = false;
+				slot -> lastUse = ++useCounter;
+				content = CachedContent (c, slot, true);
+			} else {
+				// Not cacheable (UNKNOWN_SIZE is also caught here)
+				content = CachedContent (c, nullptr, false);
+			}
+		}
+
+		return content;
+	}
+
+	void release (Content& c) override {
+		CachedContent& cc = static_cast<CachedContent&> (c);
+
+		// If the file was not read to the end, what's in the slot is useless
+		if (cc.filling)
+			cc.abortFill ();
+
+		if (cc.inner)
+			backend.release (*cc.inner);
+	}
+
+	uint32_t getGeneration () override {
+		return backend.getGeneration ();
+	}
+
+	boolean canTrackChanges () override {
+		return backend.canTrackChanges ();
+	}
+};
+
+#endif
@@ -24,6 +24,9 @@
 #include <webbino_debug.h>
 
 class HTTPRequestParser;
+class Print;
+
+typedef const byte* PGM_BYTES_P;
 
 /* Note that filename is NOT copied, so it must be kept pointing to a valid
  * string during the life of the object.
@@ -39,6 +42,9 @@ public:
 	Content (const char* _filename): filename (_filename) {
 	}
 
+	// Returned by getSize() when the size is not known in advance
+	static const unsigned long UNKNOWN_SIZE = 0xFFFFFFFFUL;
+
 	virtual const char* getFilename () const {
 		return filename;
 	}
@@ -48,6 +54,76 @@ public:
 
 	// Please override
 	virtual byte getNextByte () = 0;
+
+	/* Reads up to len bytes into buf, returning how many were actually read.
+	 * Override if the underlying medium can do better than one byte at a time.
+	 */
+	virtual size_t read (byte *buf, size_t len) {
+		size_t n = 0;
+		while (n < len && available ())
+			buf[n++] = getNextByte ();
+
+		return n;
+	}
+
+	/* Override if the content lies in memory that can be read directly (i.e.:
+	 * memory-mapped flash), to avoid copying it around: set data to point to
+	 * the next (up to) maxLen bytes and return how many there are, which are
+	 * then considered read. Return 0 if this is not possible, in which case
+	 * read() will be used instead.
+	 */
+	virtual size_t readSpan (const byte*& data, size_t maxLen) {
+		(void) data;
+		(void) maxLen;
+		return 0;
+	}
+
+	/* Override to return a strong validator for the content, i.e. a value
+	 * that changes whenever the content does. It will be sent to clients as
+	 * an ETag. 0 means that no such value is available.
+	 */
+	virtual uint32_t getETag () {
+		return 0;
+	}
+
+	/* Override these two to support Range requests: getSize() must return
+	 * the total size of the content, while seek() must move to the given
+	 * offset so that the following getNextByte() returns the byte there.
+	 */
+	virtual unsigned long getSize () {
+		return UNKNOWN_SIZE;
+	}
+
+	virtual boolean seek (unsigned long pos) {
+		(void) pos;
+		return false;
+	}
+
+	/* Override if the MIME type of the content is known in advance, otherwise
+	 * it will be guessed from the filename extension. Must return a PROGMEM
+	 * string.
+	 */
+	virtual PGM_P getContentType () {
+		return nullptr;
+	}
+
+	/* Override to return false if the content is known not to contain any
+	 * replacement tags, so that it can be sent as-is even if it is text.
+	 */
+	virtual boolean mayContainTags () {
+		return true;
+	}
+
+	/* Override for contents that are produced on the fly rather than read: if
+	 * this returns true, it is assumed to have written the whole body to out
+	 * and nothing is read from the content at all. Such contents should also
+	 * return false from mayContainTags().
+	 */
+	virtual boolean generate (Print& out, HTTPRequestParser& request) {
+		(void) out;
+		(void) request;
+		return false;
+	}
 };
 
 #endif
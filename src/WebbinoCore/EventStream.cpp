@@ -0,0 +1,167 @@
+/***************************************************************************
+ *   This file is part of Webbino                                          *
+ *                                                                         *
+ *   Copyright (C) 2012-2019 by SukkoPera                                  *
+ *                                                                         *
+ *   Webbino is free software: you can redistribute it and/or modify       *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation, either version 3 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   Webbino is distributed in the hope that it will be useful,            *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with Webbino. If not, see <http://www.gnu.org/licenses/>.       *
+ ***************************************************************************/
+
+#include "EventStream.h"
+
+#ifdef MAX_EVENT_SUBSCRIBERS
+
+#include "WebClient.h"
+
+EventStream::EventStream (const char* _path): path (_path), next (nullptr), inEvent (false) {
+	for (byte i = 0; i < MAX_EVENT_SUBSCRIBERS; ++i)
+		subscribers[i] = nullptr;
+}
+
+void EventStream::prune () {
+	for (byte i = 0; i < MAX_EVENT_SUBSCRIBERS; ++i) {
+		WebClient* sub = subscribers[i];
+		if (sub && !sub -> connected ()) {
+			DPRINT (F("Dropping subscriber of "));
+			DPRINTLN (path);
+			sub -> close ();
+			subscribers[i] = nullptr;
+		}
+	}
+}
+
+boolean EventStream::addSubscriber (WebClient* client) {
+	boolean ret = false;
+
+	for (byte i = 0; !ret && i < MAX_EVENT_SUBSCRIBERS; ++i) {
+		if (!subscribers[i]) {
+			subscribers[i] = client;
+			ret = true;
+		}
+	}
+
+	return ret;
+}
+
+byte EventStream::getSubscriberCount () const {
+	byte ret = 0;
+
+	for (byte i = 0; i < MAX_EVENT_SUBSCRIBERS; ++i) {
+		if (subscribers[i])
+			++ret;
+	}
+
+	return ret;
+}
+
+void EventStream::broadcast (const uint8_t* buf, size_t n) {
+	if (n > 0) {
+		for (byte i = 0; i < MAX_EVENT_SUBSCRIBERS; ++i) {
+			if (subscribers[i])
+				subscribers[i] -> write (buf, n);
+		}
+	}
+}
+
+void EventStream::broadcast_P (PGM_P str) {
+	uint8_t c;
+	while ((c = pgm_read_byte (str++)))
+		broadcast (&c, 1);
+}
+
+void EventStream::startEvent () {
+	if (inEvent)
+		endEvent ();
+
+	prune ();
+}
+
+void EventStream::beginEvent (const char* name) {
+	startEvent ();
+
+	if (name) {
+		broadcast_P (PSTR ("event: "));
+		broadcast (reinterpret_cast<const uint8_t*> (name), strlen (name));
+		broadcast_P (PSTR ("\n"));
+	}
+	broadcast_P (PSTR ("data: "));
+	inEvent = true;
+}
+
+#ifdef ENABLE_FLASH_STRINGS
+void EventStream::beginEvent (WebbinoFStr name) {
+	startEvent ();
+
+	broadcast_P (PSTR ("event: "));
+	broadcast_P (F_TO_PSTR (name));
+	broadcast_P (PSTR ("\ndata: "));
+	inEvent = true;
+}
+#endif
+
+void EventStream::endEvent () {
+	if (inEvent) {
+		// A blank line dispatches the event
+		broadcast_P (PSTR ("\n\n"));
+		for (byte i = 0; i < MAX_EVENT_SUBSCRIBERS; ++i) {
+			if (subscribers[i])
+				subscribers[i] -> flush ();
+		}
+
+		inEvent = false;
+	}
+}
+
+void EventStream::send (const char* data, const char* name) {
+	beginEvent (name);
+	print (data);
+	endEvent ();
+}
+
+size_t EventStream::write (uint8_t c) {
+	size_t ret = 0;
+
+	if (inEvent) {
+		// Every line of data needs its own field
+		if (c == '\n')
+			broadcast_P (PSTR ("\ndata: "));
+		else if (c != '\r')
+			broadcast (&c, 1);
+
+		ret = 1;
+	}
+
+	return ret;
+}
+
+size_t EventStream::write (const uint8_t* buf, size_t n) {
+	size_t ret = 0;
+
+	if (inEvent) {
+		size_t start = 0;
+		for (size_t i = 0; i < n; ++i) {
+			if (buf[i] == '\n' || buf[i] == '\r') {
+				broadcast (buf + start, i - start);
+				write (buf[i]);
+				start = i + 1;
+			}
+		}
+		broadcast (buf + start, n - start);
+
+		ret = n;
+	}
+
+	return ret;
+}
+
+#endif
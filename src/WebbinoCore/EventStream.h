@@ -0,0 +1,94 @@
+/***************************************************************************
+ *   This file is part of Webbino                                          *
+ *                                                                         *
+ *   Copyright (C) 2012-2019 by SukkoPera                                  *
+ *                                                                         *
+ *   Webbino is free software: you can redistribute it and/or modify       *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation, either version 3 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   Webbino is distributed in the hope that it will be useful,            *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with Webbino. If not, see <http://www.gnu.org/licenses/>.       *
+ ***************************************************************************/
+
+#ifndef _EVENTSTREAM_H_
+#define _EVENTSTREAM_H_
+
+#include <Arduino.h>
+#include <webbino_config.h>
+#include <webbino_debug.h>
+
+#ifdef MAX_EVENT_SUBSCRIBERS
+
+class WebClient;
+
+/* A URL that browsers can subscribe to through an EventSource, so that updates
+ * are pushed to them as Server-Sent Events, instead of being polled for. Add it
+ * to the WebServer with addEventStream(), then send events from loop(), i.e.:
+ *
+ *   events.beginEvent (F("uptime"));
+ *   events.print (millis () / 1000);
+ *   events.endEvent ();
+ *
+ * Whatever is printed in between goes to all subscribers, and can span more
+ * lines. Events with no name reach the onmessage handler of the EventSource.
+ */
+class EventStream: public Print {
+private:
+	friend class WebServer;
+
+	const char* path;
+	WebClient* subscribers[MAX_EVENT_SUBSCRIBERS];
+	EventStream* next;
+	boolean inEvent;
+
+	// Closes the connections of subscribers that went away
+	void prune ();
+
+	boolean addSubscriber (WebClient* client);
+
+	// Sends bytes as they are to all subscribers
+	void broadcast (const uint8_t* buf, size_t n);
+
+	void broadcast_P (PGM_P str);
+
+	void startEvent ();
+
+public:
+	// The path is not copied, so it must stay around
+	explicit EventStream (const char* _path);
+
+	const char* getPath () const {
+		return path;
+	}
+
+	byte getSubscriberCount () const;
+
+	// The name must not contain newlines
+	void beginEvent (const char* name = nullptr);
+
+#ifdef ENABLE_FLASH_STRINGS
+	void beginEvent (WebbinoFStr name);
+#endif
+
+	void endEvent ();
+
+	// Sends a whole event at once
+	void send (const char* data, const char* name = nullptr);
+
+	size_t write (uint8_t c) override;
+
+	size_t write (const uint8_t* buf, size_t n) override;
+
+	using Print::write;
+};
+
+#endif
+
+#endif
@@ -23,12 +23,15 @@
 
 typedef void (*PageFunction) (HTTPRequestParser& request);
 
-typedef const byte* PGM_BYTES_P;
-
+/* Note that pages are accessed through normal (near) pointers, so on the
+ * Mega2560 they must all lie in the lower 64 KB of flash. For bigger sites use a
+ * far packed image, see PackedFlashStorage.h.
+ */
 struct Page {
 	PGM_P name;
 	PGM_BYTES_P content;
 	unsigned int length;
+	uint32_t etag;			// Computed by html2h.py, 0 if not available
 
 	// Methods that (try to) hide the complexity of accessing PROGMEM data
 	PGM_P getName () const {
@@ -40,10 +43,12 @@ struct Page {
 	}
 
 	unsigned int getLength () const {
-		/* FIXME This gets truncated to 16 bits on platforms with wider ints,
-		 * see #5
-		 */
-		return pgm_read_word (&(this -> length));
+		// Platforms with wider ints must read all of it, see #5
+		return sizeof (length) > 2 ? pgm_read_dword (&(this -> length)) : pgm_read_word (&(this -> length));
+	}
+
+	uint32_t getETag () const {
+		return pgm_read_dword (&(this -> etag));
 	}
 };
 
@@ -121,6 +126,38 @@ public:
 		++offset;
 		return pgm_read_byte (next++);
 	}
+
+	size_t read (byte *buf, size_t len) override {
+		unsigned int left = page -> getLength () - offset;
+		if (len > left)
+			len = left;
+
+		memcpy_P (buf, next, len);
+		next += len;
+		offset += len;
+
+		return len;
+	}
+
+	uint32_t getETag () override {
+		return page -> getETag ();
+	}
+
+	unsigned long getSize () override {
+		return page -> getLength ();
+	}
+
+	boolean seek (unsigned long pos) override {
+		boolean ret = false;
+
+		if (pos <= page -> getLength ()) {
+			next = page -> getContent () + pos;
+			offset = pos;
+			ret = true;
+		}
+
+		return ret;
+	}
 };
 
 /******************************************************************************/
@@ -176,4 +213,9 @@ public:
 	void release (Content& content) override {
 		content = FlashContent ();
 	}
+
+	// Pages are fixed
+	boolean canTrackChanges () override {
+		return true;
+	}
 };
@@ -0,0 +1,97 @@
+/***************************************************************************
+ *   This file is part of Webbino                                          *
+ *                                                                         *
+ *   Copyright (C) 2012-2019 by SukkoPera                                  *
+ *                                                                         *
+ *   Webbino is free software: you can redistribute it and/or modify       *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation, either version 3 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   Webbino is distributed in the hope that it will be useful,            *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with Webbino. If not, see <http://www.gnu.org/licenses/>.       *
+ ***************************************************************************/
+
+#include "Format.h"
+
+static const uint32_t powersOf10[] PROGMEM = {
+	1000000000UL,
+	100000000UL,
+	10000000UL,
+	1000000UL,
+	100000UL,
+	10000UL,
+	1000UL,
+	100UL,
+	10UL
+};
+
+byte formatUnsigned (char *buf, uint32_t val) {
+	byte len = 0;
+
+	for (byte i = 0; i < sizeof (powersOf10) / sizeof (powersOf10[0]); ++i) {
+		const uint32_t pow = pgm_read_dword (&powersOf10[i]);
+
+		char digit = '0';
+		while (val >= pow) {
+			val -= pow;
+			++digit;
+		}
+
+		// Skip leading zeros
+		if (digit != '0' || len > 0)
+			buf[len++] = digit;
+	}
+
+	// Units are what is left
+	buf[len++] = '0' + static_cast<char> (val);
+	buf[len] = '\0';
+
+	return len;
+}
+
+byte formatSigned (char *buf, int32_t val) {
+	byte ret;
+
+	if (val < 0) {
+		buf[0] = '-';
+		ret = formatUnsigned (buf + 1, -static_cast<uint32_t> (val)) + 1;
+	} else {
+		ret = formatUnsigned (buf, val);
+	}
+
+	return ret;
+}
+
+byte formatFixed (char *buf, int32_t val, byte decimals) {
+	byte len = 0;
+
+	if (decimals > 9)
+		decimals = 9;
+
+	uint32_t uval = val;
+	if (val < 0) {
+		buf[len++] = '-';
+		uval = -uval;
+	}
+
+	char digits[FORMAT_BUF_LEN];
+	const byte nDigits = formatUnsigned (digits, uval);
+
+	// Pad with zeros, so that there is at least one digit before the point
+	const byte total = nDigits > decimals ? nDigits : decimals + 1;
+	const byte padding = total - nDigits;
+	for (byte i = 0; i < total; ++i) {
+		if (decimals > 0 && i == total - decimals)
+			buf[len++] = '.';
+		buf[len++] = i < padding ? '0' : digits[i - padding];
+	}
+	buf[len] = '\0';
+
+	return len;
+}
@@ -0,0 +1,43 @@
+/***************************************************************************
+ *   This file is part of Webbino                                          *
+ *                                                                         *
+ *   Copyright (C) 2012-2019 by SukkoPera                                  *
+ *                                                                         *
+ *   Webbino is free software: you can redistribute it and/or modify       *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation, either version 3 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   Webbino is distributed in the hope that it will be useful,            *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with Webbino. If not, see <http://www.gnu.org/licenses/>.       *
+ ***************************************************************************/
+
+#ifndef _WEBBINO_FORMAT_H_
+#define _WEBBINO_FORMAT_H_
+
+#include <Arduino.h>
+
+/* Number formatters for tags bound to variables. Digits are found by
+ * subtracting powers of 10 taken from a table, rather than by dividing as
+ * Print does, which is much faster on CPUs without a hardware divider.
+ *
+ * All of them write a NUL-terminated string to buf, which must be at least
+ * FORMAT_BUF_LEN bytes long, and return its length.
+ */
+const byte FORMAT_BUF_LEN = 13;		// "-2147483648", a decimal point and NUL
+
+byte formatUnsigned (char *buf, uint32_t val);
+
+byte formatSigned (char *buf, int32_t val);
+
+/* Formats val as a fixed-point number with the given number of decimals (up
+ * to 9), i.e.: 2150 with 2 decimals is "21.50"
+ */
+byte formatFixed (char *buf, int32_t val, byte decimals);
+
+#endif
@@ -0,0 +1,181 @@
+/***************************************************************************
+ *   This file is part of Webbino                                          *
+ *                                                                         *
+ *   Copyright (C) 2012-2019 by SukkoPera                                  *
+ *                                                                         *
+ *   Webbino is free software: you can redistribute it and/or modify       *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation, either version 3 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   Webbino is distributed in the hope that it will be useful,            *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with Webbino. If not, see <http://www.gnu.org/licenses/>.       *
+ ***************************************************************************/
+
+#ifndef GENERATORSTORAGE_H_INCLUDED
+#define GENERATORSTORAGE_H_INCLUDED
+
+#include <Arduino.h>
+#include "Storage.h"
+#include "Content.h"
+#include "HTTPRequestParser.h"
+#include "webbino_common.h"
+
+/* A generator writes the whole body of a page to out, as it goes. It can get
+ * at the request parameters through request.
+ */
+typedef void (*GeneratorFn) (Print& out, HTTPRequestParser& request, void *data);
+
+struct GeneratorEntry {
+	PGM_P path;
+	PGM_P mimeType;
+	GeneratorFn function;
+	void *data;
+
+	// Methods that (try to) hide the complexity of accessing PROGMEM data
+	PGM_P getPath () const {
+		return reinterpret_cast<PGM_P> (pgm_read_ptr (&(this -> path)));
+	}
+
+	PGM_P getMimeType () const {
+		return reinterpret_cast<PGM_P> (pgm_read_ptr (&(this -> mimeType)));
+	}
+
+	GeneratorFn getFunction () const {
+		return reinterpret_cast<GeneratorFn> (pgm_read_ptr (&(this -> function)));
+	}
+
+	void *getData () const {
+		return reinterpret_cast<void *> (const_cast<void *> (pgm_read_ptr (&(this -> data))));
+	}
+};
+
+/* Macros that simplify things, i.e.:
+ * EasyGenerator (genStatus, "/status.json", "application/json", writeStatus);
+ */
+#define GENERATOR_PATH_VAR(var) _genPath_ ## var
+#define GENERATOR_MIME_VAR(var) _genMime_ ## var
+
+#define EasyGeneratorWithArg(var, path, mime, fn, arg) \
+	const char GENERATOR_PATH_VAR(var)[] PROGMEM = path; \
+	const char GENERATOR_MIME_VAR(var)[] PROGMEM = mime; \
+	const GeneratorEntry var PROGMEM = {GENERATOR_PATH_VAR(var), GENERATOR_MIME_VAR(var), fn, reinterpret_cast<void *> (arg)};
+
+#define EasyGenerator(var, path, mime, fn) EasyGeneratorWithArg(var, path, mime, fn, NULL)
+
+typedef const GeneratorEntry* const GeneratorEntryArray;
+
+class GeneratorContent: public Content {
+private:
+	const GeneratorEntry *entry;
+
+public:
+	GeneratorContent (): entry (nullptr) {
+	}
+
+	GeneratorContent (const char* filename, const GeneratorEntry *e): Content (filename), entry (e) {
+	}
+
+	// There is nothing to read, see generate()
+	boolean available () override {
+		return false;
+	}
+
+	byte getNextByte () override {
+		return 0;
+	}
+
+	PGM_P getContentType () override {
+		return entry ? entry -> getMimeType () : nullptr;
+	}
+
+	boolean mayContainTags () override {
+		return false;
+	}
+
+	boolean generate (Print& out, HTTPRequestParser& request) override {
+		boolean ret = false;
+
+		if (entry) {
+			GeneratorFn fn = entry -> getFunction ();
+			fn (out, request, entry -> getData ());
+			ret = true;
+		}
+
+		return ret;
+	}
+};
+
+/******************************************************************************/
+
+
+/* Serves pages that are entirely produced by functions, such as JSON or CSV
+ * endpoints, with no template file behind them and no tag processing. The
+ * output of the function is sent to the client as it is produced. Usage:
+ *   void writeStatus (Print& out, HTTPRequestParser& request, void *data) {
+ *   	out.print (F("{\"uptime\": "));
+ *   	out.print (millis ());
+ *   	out.print ('}');
+ *   }
+ *
+ *   EasyGenerator (genStatus, "/status.json", "application/json", writeStatus);
+ *   GeneratorEntryArray generators[] PROGMEM = {&genStatus, NULL};
+ *
+ *   GeneratorStorage genStorage;
+ *   ...
+ *   genStorage.begin (generators);
+ *   webserver.addStorage (genStorage);
+ */
+class GeneratorStorage: public Storage {
+private:
+	GeneratorEntryArray *entries = nullptr;
+	GeneratorContent content;
+
+	const GeneratorEntry *find (const char* filename) const {
+		const GeneratorEntry *ret = nullptr;
+
+		const GeneratorEntry *e;
+		for (byte i = 0; !ret && entries && (e = reinterpret_cast<const GeneratorEntry*> (pgm_read_ptr (&entries[i]))); ++i) {
+			if (strcmp_P (filename, e -> getPath ()) == 0)
+				ret = e;
+		}
+
+		return ret;
+	}
+
+public:
+	void begin (GeneratorEntryArray *_entries) {
+		entries = _entries;
+
+#ifndef WEBBINO_NDEBUG
+		DPRINTLN (F("Available Generators:"));
+		const GeneratorEntry *e;
+		for (byte i = 0; entries && (e = reinterpret_cast<const GeneratorEntry*> (pgm_read_ptr (&entries[i]))); ++i) {
+			DPRINT (i);
+			DPRINT (F(". "));
+			DPRINTLN (PSTR_TO_F (e -> getPath ()));
+		}
+#endif
+	}
+
+	boolean exists (const char* filename) override {
+		return find (filename) != nullptr;
+	}
+
+	Content& get (const char* filename) override {
+		content = GeneratorContent (filename, find (filename));
+		return content;
+	}
+
+	// Generators are fixed
+	boolean canTrackChanges () override {
+		return true;
+	}
+};
+
+#endif
@@ -20,8 +20,111 @@
 #include <Arduino.h>
 #include "HTTPRequestParser.h"
 
-HTTPRequestParser::HTTPRequestParser () {
+#define IF_NONE_MATCH_HEADER "If-None-Match:"
+#define RANGE_HEADER "Range:"
+#define HEADER_MATCHES(line, len, hdr) \
+	((len) > sizeof (hdr) - 1 && strncasecmp_P ((line), PSTR (hdr), sizeof (hdr) - 1) == 0)
+
+HTTPRequestParser::HTTPRequestParser (): method (METHOD_UNKNOWN), rangeType (RANGE_NONE) {
 	url[0] = '\0';
+	ifNoneMatch[0] = '\0';
+}
+
+boolean HTTPRequestParser::isRelevantLine (const char *line, unsigned int len, boolean first) {
+	boolean ret;
+
+	if (first) {
+		ret = (len > 4 && strncmp_P (line, PSTR ("GET "), 4) == 0) ||
+			  (len > 5 && strncmp_P (line, PSTR ("HEAD "), 5) == 0);
+	} else {
+		ret = HEADER_MATCHES (line, len, IF_NONE_MATCH_HEADER) ||
+			  HEADER_MATCHES (line, len, RANGE_HEADER);
+	}
+
+	return ret;
+}
+
+// Copies a header value, skipping leading blanks and stopping at end of line
+static void copyHeaderValue (char *dest, const char *value, size_t size) {
+	while (*value == ' ' || *value == '\t')
+		++value;
+
+	size_t i;
+	for (i = 0; i < size - 1 && value[i] != '\0' && value[i] != '\r' && value[i] != '\n'; ++i)
+		dest[i] = value[i];
+	dest[i] = '\0';
+}
+
+// Parses a decimal number, returns NULL if there is none
+static const char *parseNumber (const char *p, unsigned long& n) {
+	const char *ret = NULL;
+
+	if (*p >= '0' && *p <= '9') {
+		n = 0;
+		while (*p >= '0' && *p <= '9') {
+			byte d = *p++ - '0';
+			if (n > (HTTPRequestParser::RANGE_END - d) / 10) {
+				// Beyond any file we can serve, don't let it wrap around
+				n = HTTPRequestParser::RANGE_END;
+				while (*p >= '0' && *p <= '9')
+					++p;
+			} else {
+				n = n * 10 + d;
+			}
+		}
+		ret = p;
+	}
+
+	return ret;
+}
+
+void HTTPRequestParser::parseRange (const char *value) {
+	while (*value == ' ' || *value == '\t')
+		++value;
+
+	if (strncmp_P (value, PSTR ("bytes="), 6) == 0) {
+		const char *p = value + 6;
+
+		if (*p == '-') {
+			if ((p = parseNumber (p + 1, rangeFirst)) && rangeFirst > 0)
+				rangeType = RANGE_SUFFIX;
+		} else if ((p = parseNumber (p, rangeFirst)) && *p == '-') {
+			if (*++p >= '0' && *p <= '9')
+				p = parseNumber (p, rangeLast);
+			else
+				rangeLast = RANGE_END;
+
+			if (rangeLast >= rangeFirst)
+				rangeType = RANGE_FROM;
+		}
+
+		// Only accept a single range, terminated by end of line
+		if (rangeType != RANGE_NONE && (!p || (*p != '\0' && *p != '\r' && *p != '\n')))
+			rangeType = RANGE_NONE;
+	}
+
+#ifdef VERBOSE_REQUEST_PARSER
+	DPRINT (F("Range type: "));
+	DPRINT (rangeType);
+	DPRINT (F(", "));
+	DPRINT (rangeFirst);
+	DPRINT (F("-"));
+	DPRINTLN (rangeLast);
+#endif
+}
+
+void HTTPRequestParser::parseHeader (const char *line) {
+	if (strncasecmp_P (line, PSTR (RANGE_HEADER), sizeof (RANGE_HEADER) - 1) == 0) {
+		parseRange (line + sizeof (RANGE_HEADER) - 1);
+	} else if (strncasecmp_P (line, PSTR (IF_NONE_MATCH_HEADER), sizeof (IF_NONE_MATCH_HEADER) - 1) == 0) {
+		copyHeaderValue (ifNoneMatch, line + sizeof (IF_NONE_MATCH_HEADER) - 1, MAX_IF_NONE_MATCH_LEN);
+
+#ifdef VERBOSE_REQUEST_PARSER
+		DPRINT (F("If-None-Match: \""));
+		DPRINT (ifNoneMatch);
+		DPRINTLN (F("\""));
+#endif
+	}
 }
 
 void HTTPRequestParser::parse (char *request) {
@@ -34,17 +137,34 @@ void HTTPRequestParser::parse (char *request) {
 #endif
 
 	url[0] = '\0';
-	if ((p = strstr_P (request, PSTR ("GET ")))) {
-		if ((q = strchr (p + 4,  ' ')))
-			strlcpy (url, p + 4, q - p - 4 + 1 < MAX_URL_LEN ? q - p - 4 + 1 : MAX_URL_LEN);
+	ifNoneMatch[0] = '\0';
+	method = METHOD_UNKNOWN;
+	rangeType = RANGE_NONE;
+
+	p = nullptr;
+	if (strncmp_P (request, PSTR ("GET "), 4) == 0) {
+		method = METHOD_GET;
+		p = request + 4;
+	} else if (strncmp_P (request, PSTR ("HEAD "), 5) == 0) {
+		method = METHOD_HEAD;
+		p = request + 5;
+	}
+
+	if (p) {
+		if ((q = strpbrk (p, " \r\n")))
+			strlcpy (url, p, q - p + 1 < MAX_URL_LEN ? q - p + 1 : MAX_URL_LEN);
 		else
-			strlcpy (url, p + 4, MAX_URL_LEN);
+			strlcpy (url, p, MAX_URL_LEN);
 
 #ifdef VERBOSE_REQUEST_PARSER
 		DPRINT (F("Extracted URL: \""));
 		DPRINT (url);
 		DPRINTLN (F("\""));
 #endif
+
+		// Now go through the headers, if any
+		for (p = strchr (p, '\n'); p; p = strchr (p, '\n'))
+			parseHeader (++p);
 	} else {
 		DPRINTLN (F("Cannot extract URL"));
 	}
@@ -105,6 +225,173 @@ char *HTTPRequestParser::get_parameter (const char param[]) {
 	return buffer;
 }
 
+static boolean parseBool (const char *val, size_t len, int32_t& out) {
+	boolean ret = true;
+
+	if ((len == 1 && *val == '1') ||
+		  (len == 2 && strncasecmp_P (val, PSTR ("on"), 2) == 0) ||
+		  (len == 3 && strncasecmp_P (val, PSTR ("yes"), 3) == 0) ||
+		  (len == 4 && strncasecmp_P (val, PSTR ("true"), 4) == 0)) {
+		out = 1;
+	} else if ((len == 1 && *val == '0') ||
+		  (len == 3 && strncasecmp_P (val, PSTR ("off"), 3) == 0) ||
+		  (len == 2 && strncasecmp_P (val, PSTR ("no"), 2) == 0) ||
+		  (len == 5 && strncasecmp_P (val, PSTR ("false"), 5) == 0)) {
+		out = 0;
+	} else {
+		ret = false;
+	}
+
+	return ret;
+}
+
+static boolean parseInt (const char *val, size_t len, int32_t& out) {
+	boolean neg = false;
+	size_t i = 0;
+
+	if (len > 0 && (*val == '-' || *val == '+')) {
+		neg = *val == '-';
+		++i;
+	}
+
+	// Require at least one digit, and no more than 9 to avoid overflows
+	boolean ret = i < len && len - i <= 9;
+	int32_t n = 0;
+	for (; ret && i < len; ++i) {
+		if (val[i] >= '0' && val[i] <= '9')
+			n = n * 10 + (val[i] - '0');
+		else
+			ret = false;
+	}
+
+	if (ret)
+		out = neg ? -n : n;
+
+	return ret;
+}
+
+static byte hexDigit (char c) {
+	if (c >= '0' && c <= '9')
+		return c - '0';
+	else if (c >= 'a' && c <= 'f')
+		return c - 'a' + 10;
+	else if (c >= 'A' && c <= 'F')
+		return c - 'A' + 10;
+	else
+		return 0xFF;
+}
+
+void HTTPRequestParser::decode (char *dest, size_t size, const char *val, size_t len) {
+	size_t j = 0;
+
+	for (size_t i = 0; i < len && j < size - 1; ++i) {
+		char c = val[i];
+		if (c == '+') {
+			c = ' ';
+		} else if (c == '%' && i + 2 < len) {
+			byte hi = hexDigit (val[i + 1]), lo = hexDigit (val[i + 2]);
+			if (hi != 0xFF && lo != 0xFF) {
+				c = (hi << 4) | lo;
+				i += 2;
+			}
+		}
+		dest[j++] = c;
+	}
+
+	dest[j] = '\0';
+}
+
+// Stores an integer in a field of the given size
+static void storeInt (void *field, uint16_t size, int32_t val) {
+	switch (size) {
+		case 1:
+			*reinterpret_cast<int8_t *> (field) = val;
+			break;
+		case 2:
+			*reinterpret_cast<int16_t *> (field) = val;
+			break;
+		case 4:
+			*reinterpret_cast<int32_t *> (field) = val;
+			break;
+		default:
+			DPRINTLN (F("WARNING: Unsupported parameter field size"));
+			break;
+	}
+}
+
+PageParamMask HTTPRequestParser::bind_parameters (PageParameterArray *params, void *data) {
+	byte *base = reinterpret_cast<byte *> (data);
+	const PageParameter *pp;
+	PageParamMask found = 0;
+
+	// Set defaults first
+	byte i;
+	for (i = 0; i < MAX_PAGE_PARAMS && (pp = reinterpret_cast<const PageParameter *> (pgm_read_ptr (&params[i]))); ++i) {
+		void *field = base + pp -> getOffset ();
+		if (pp -> getType () == PageParameter::TYPE_STRING)
+			*reinterpret_cast<char *> (field) = '\0';
+		else
+			storeInt (field, pp -> getSize (), pp -> getDefault ());
+	}
+
+	if (i == MAX_PAGE_PARAMS && pgm_read_ptr (&params[i])) {
+		DPRINT (F("Too many page parameters, only binding the first "));
+		DPRINTLN (MAX_PAGE_PARAMS);
+	}
+
+	// Then go through the query string once
+	for (char *start = strchr (url, '?'); start; start = strchr (start + 1, '&')) {
+		const char *name = start + 1;
+		const char *eq = strchr (name, '=');
+		const char *end = strchr (name, '&');
+		if (!end)
+			end = name + strlen (name);
+		if (!eq || eq > end)
+			continue;		// Parameter without value
+
+		size_t nameLen = eq - name;
+		const char *val = eq + 1;
+		size_t valLen = end - val;
+
+		for (i = 0; i < MAX_PAGE_PARAMS && (pp = reinterpret_cast<const PageParameter *> (pgm_read_ptr (&params[i]))); ++i) {
+			PGM_P ppName = pp -> getName ();
+			if (strlen_P (ppName) == nameLen && strncmp_P (name, ppName, nameLen) == 0) {
+				void *field = base + pp -> getOffset ();
+				int32_t n;
+
+				switch (pp -> getType ()) {
+					case PageParameter::TYPE_BOOL:
+						if (parseBool (val, valLen, n)) {
+							storeInt (field, pp -> getSize (), n);
+							found |= PAGEPARAM_BIT (i);
+						}
+						break;
+					case PageParameter::TYPE_INT:
+						if (parseInt (val, valLen, n) && n >= pp -> getMin () && n <= pp -> getMax ()) {
+							storeInt (field, pp -> getSize (), n);
+							found |= PAGEPARAM_BIT (i);
+						}
+						break;
+					case PageParameter::TYPE_STRING:
+						decode (reinterpret_cast<char *> (field), pp -> getSize (), val, valLen);
+						found |= PAGEPARAM_BIT (i);
+						break;
+				}
+
+#ifdef VERBOSE_REQUEST_PARSER
+				DPRINT (F("Bound parameter \""));
+				DPRINT (PSTR_TO_F (ppName));
+				DPRINT (F("\": "));
+				DPRINTLN ((found & PAGEPARAM_BIT (i)) ? F("OK") : F("invalid"));
+#endif
+				break;
+			}
+		}
+	}
+
+	return found;
+}
+
 #ifdef ENABLE_FLASH_STRINGS
 char *HTTPRequestParser::get_parameter (WebbinoFStr param) {
 	strncpy_P (buffer, F_TO_PSTR (param), BUF_LEN);
@@ -20,21 +20,152 @@
 #ifndef _HTTPREQUESTPARSER_H_
 #define _HTTPREQUESTPARSER_H_
 
+#include <Arduino.h>
+#include <stddef.h>
 #include <webbino_config.h>
 #include <webbino_debug.h>
 
+/* Describes a GET parameter that a page expects, so that it can be extracted
+ * and converted into a field of a user-defined struct, see
+ * HTTPRequestParser::bind_parameters(). Use the PageParam*() macros below to
+ * define these.
+ */
+struct PageParameter {
+	enum Type {
+		TYPE_BOOL,			// boolean field: "1", "on", "true" or "yes" and their opposites
+		TYPE_INT,			// Any signed integer field, value must be in [min, max]
+		TYPE_STRING			// char array field, URL-decoded and truncated if needed
+	};
+
+	PGM_P name;
+	byte type;
+	uint16_t offset;		// Offset of the field in the struct
+	uint16_t size;			// Size of the field in the struct
+	int32_t min;
+	int32_t max;
+	int32_t def;			// Default value (ignored for strings, which default to "")
+
+	// Methods that (try to) hide the complexity of accessing PROGMEM data
+	PGM_P getName () const {
+		return reinterpret_cast<PGM_P> (pgm_read_ptr (&(this -> name)));
+	}
+
+	byte getType () const {
+		return pgm_read_byte (&(this -> type));
+	}
+
+	uint16_t getOffset () const {
+		return pgm_read_word (&(this -> offset));
+	}
+
+	uint16_t getSize () const {
+		return pgm_read_word (&(this -> size));
+	}
+
+	int32_t getMin () const {
+		return pgm_read_dword (&(this -> min));
+	}
+
+	int32_t getMax () const {
+		return pgm_read_dword (&(this -> max));
+	}
+
+	int32_t getDefault () const {
+		return pgm_read_dword (&(this -> def));
+	}
+};
+
+typedef const PageParameter* const PageParameterArray;
+
+/* Bitmask of the parameters that were found in a request, bit n is set if the
+ * n-th parameter was found and valid. This means that no more than
+ * MAX_PAGE_PARAMS (16) parameters can be handled per page: any further ones
+ * are ignored, and left untouched.
+ */
+typedef uint16_t PageParamMask;
+
+#define MAX_PAGE_PARAMS (sizeof (PageParamMask) * 8)
+
+#define PAGEPARAM_BIT(n) (static_cast<PageParamMask> (1U << (n)))
+
+#define PAGEPARAM_STR_VAR(var) _ppStr_ ## var
+#define PAGEPARAM_FIELD_SIZE(type, field) sizeof (static_cast<type *> (nullptr) -> field)
+
+#define PageParam(var, name, ptype, type, field, min, max, def) \
+	const char PAGEPARAM_STR_VAR(var)[] PROGMEM = name; \
+	const PageParameter var PROGMEM = {PAGEPARAM_STR_VAR(var), ptype, offsetof (type, field), PAGEPARAM_FIELD_SIZE (type, field), min, max, def};
+
+#define PageParamInt(var, name, type, field, min, max, def) \
+	PageParam (var, name, PageParameter::TYPE_INT, type, field, min, max, def)
+
+#define PageParamBool(var, name, type, field, def) \
+	PageParam (var, name, PageParameter::TYPE_BOOL, type, field, 0, 1, def)
+
+#define PageParamString(var, name, type, field) \
+	PageParam (var, name, PageParameter::TYPE_STRING, type, field, 0, 0, 0)
+
 
 class HTTPRequestParser {
 private:
 	char buffer[BUF_LEN];
 
+	void parseHeader (const char *line);
+
+	void parseRange (const char *value);
+
 public:
+	enum Method {
+		METHOD_UNKNOWN,
+		METHOD_GET,
+		METHOD_HEAD
+	};
+
+	enum RangeType {
+		RANGE_NONE,			// No (usable) Range header
+		RANGE_FROM,			// "bytes=first-last" or "bytes=first-"
+		RANGE_SUFFIX		// "bytes=-length"
+	};
+
+	// Used as rangeLast for ranges with no end
+	static const unsigned long RANGE_END = 0xFFFFFFFFUL;
+
 	HTTPRequestParser ();
 
+	Method method;
+
 	char url[MAX_URL_LEN];
 
+	// Value of the If-None-Match header, empty if not present
+	char ifNoneMatch[MAX_IF_NONE_MATCH_LEN];
+
+	/* Byte range requested through the Range header. For RANGE_FROM,
+	 * rangeFirst and rangeLast are the offsets of the first and last
+	 * requested byte (rangeLast is RANGE_END if not specified), for
+	 * RANGE_SUFFIX rangeFirst is the number of bytes requested from the end
+	 * of the content. Requests for multiple ranges are ignored.
+	 */
+	RangeType rangeType;
+	unsigned long rangeFirst;
+	unsigned long rangeLast;
+
+	/* Parses the request line and any header lines following it in the same
+	 * buffer.
+	 */
 	void parse (char *request);
 
+	/* Network interfaces that read requests line by line use this to decide
+	 * which lines must be kept and passed on to parse(): the request line
+	 * (first = true) and the headers we make use of. Note that line is NOT
+	 * terminated, and len includes the final '\n'.
+	 */
+	static boolean isRelevantLine (const char *line, unsigned int len, boolean first);
+
+	/* Copies the first len characters of val into dest, URL-decoding them
+	 * (i.e.: "%3A" becomes ':' and '+' a space). The result is truncated to
+	 * size - 1 characters and always terminated.
+	 */
+	static void decode (char *dest, size_t size, const char *val, size_t len);
+
 	char *get_basename ();
 
 	char *get_parameter (const char param[]);
@@ -42,6 +173,13 @@ public:
 #ifdef ENABLE_FLASH_STRINGS
 	char *get_parameter (WebbinoFStr param);
 #endif
+
+	/* Extracts all the given parameters from the query string in a single
+	 * pass, converting them and storing them into the given struct. Fields of
+	 * parameters that are not present or not valid are set to their default
+	 * values. Returns a mask of the parameters that were found.
+	 */
+	PageParamMask bind_parameters (PageParameterArray *params, void *data);
 };
 
 #endif
@@ -0,0 +1,53 @@
+/***************************************************************************
+ *   This file is part of Webbino                                          *
+ *                                                                         *
+ *   Copyright (C) 2012-2019 by SukkoPera                                  *
+ *                                                                         *
+ *   Webbino is free software: you can redistribute it and/or modify       *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation, either version 3 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   Webbino is distributed in the hope that it will be useful,            *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with Webbino. If not, see <http://www.gnu.org/licenses/>.       *
+ ***************************************************************************/
+
+#ifndef _WEBBINO_HASH_H_
+#define _WEBBINO_HASH_H_
+
+#include <Arduino.h>
+
+/* 32-bit FNV-1a, used wherever we need a cheap fingerprint of something, i.e.
+ * for ETags. See http://www.isthe.com/chongo/tech/comp/fnv/.
+ */
+const uint32_t FNV_OFFSET_BASIS = 2166136261UL;
+const uint32_t FNV_PRIME = 16777619UL;
+
+inline uint32_t fnv1a (uint32_t hash, byte b) {
+	return (hash ^ b) * FNV_PRIME;
+}
+
+inline uint32_t fnv1a (uint32_t hash, const void *data, size_t len) {
+	const byte *p = reinterpret_cast<const byte *> (data);
+	while (len--)
+		hash = fnv1a (hash, *p++);
+
+	return hash;
+}
+
+// Hashes the 4 bytes of val, LSB first
+inline uint32_t fnv1aDword (uint32_t hash, uint32_t val) {
+	for (byte i = 0; i < 4; ++i) {
+		hash = fnv1a (hash, static_cast<byte> (val & 0xFF));
+		val >>= 8;
+	}
+
+	return hash;
+}
+
+#endif
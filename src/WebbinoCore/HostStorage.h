@@ -0,0 +1,186 @@
+/***************************************************************************
+ *   This file is part of Webbino                                          *
+ *                                                                         *
+ *   Copyright (C) 2012-2019 by SukkoPera                                  *
+ *                                                                         *
+ *   Webbino is free software: you can redistribute it and/or modify       *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation, either version 3 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   Webbino is distributed in the hope that it will be useful,            *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with Webbino. If not, see <http://www.gnu.org/licenses/>.       *
+ ***************************************************************************/
+
+#ifndef HOSTSTORAGE_H_INCLUDED
+#define HOSTSTORAGE_H_INCLUDED
+
+#include <Arduino.h>
+#include "Content.h"
+#include "Hash.h"
+#include "webbino_common.h"
+
+#ifdef WEBBINO_ENABLE_HOSTFS
+
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+struct HostContent: public Content {
+public:
+	static const size_t BUFFER_SIZE = 4096;
+
+private:
+	int fd;
+	struct stat st;
+
+	// Buffer for byte-by-byte reading, belongs to HostStorage
+	byte *buf;
+	size_t bufLen;
+	size_t bufPos;
+
+public:
+	HostContent (): fd (-1), buf (nullptr), bufLen (0), bufPos (0) {
+	}
+
+	HostContent (const char* filename, int _fd, byte *_buf): Content (filename),
+		fd (_fd), buf (_buf), bufLen (0), bufPos (0) {
+
+		if (fd >= 0 && fstat (fd, &st) != 0) {
+			::close (fd);
+			fd = -1;
+		}
+	}
+
+	boolean available () override {
+		if (bufPos >= bufLen) {
+			ssize_t n = fd >= 0 ? ::read (fd, buf, BUFFER_SIZE) : 0;
+			bufLen = n > 0 ? n : 0;
+			bufPos = 0;
+		}
+
+		return bufPos < bufLen;
+	}
+
+	byte getNextByte () override {
+		return available () ? buf[bufPos++] : 0xFF;
+	}
+
+	size_t read (byte *dst, size_t len) override {
+		size_t n = 0;
+
+		if (bufPos < bufLen) {
+			n = bufLen - bufPos;
+			if (len < n)
+				n = len;
+
+			memcpy (dst, buf + bufPos, n);
+			bufPos += n;
+		}
+
+		if (n < len && fd >= 0) {
+			ssize_t r = ::read (fd, dst + n, len - n);
+			if (r > 0)
+				n += r;
+		}
+
+		return n;
+	}
+
+	uint32_t getETag () override {
+		uint32_t etag = 0;
+
+		if (fd >= 0) {
+			etag = fnv1aDword (FNV_OFFSET_BASIS, st.st_size);
+			etag = fnv1aDword (etag, static_cast<uint32_t> (st.st_mtime));
+			etag = fnv1aDword (etag, static_cast<uint32_t> (st.st_ino));
+			if (etag == 0)
+				etag = 1;
+		}
+
+		return etag;
+	}
+
+	unsigned long getSize () override {
+		return fd >= 0 ? st.st_size : UNKNOWN_SIZE;
+	}
+
+	boolean seek (unsigned long pos) override {
+		bufLen = bufPos = 0;
+		return fd >= 0 && lseek (fd, pos, SEEK_SET) == static_cast<off_t> (pos);
+	}
+
+	void close () {
+		if (fd >= 0) {
+			::close (fd);
+			fd = -1;
+		}
+	}
+};
+
+/******************************************************************************/
+
+
+/* Serves files from a directory of the host, when running Webbino on a PC (see
+ * WEBBINO_USE_HOST_SOCKETS). This is mostly useful to try out and benchmark
+ * websites without having to flash them to a board. Usage:
+ *   HostStorage hostStorage;
+ *   ...
+ *   hostStorage.begin ("examples/SimpleServer/webroot");
+ *   webserver.addStorage (hostStorage);
+ */
+class HostStorage: public Storage {
+private:
+	char root[MAX_URL_LEN];
+	char path[2 * MAX_URL_LEN];
+	byte readBuffer[HostContent::BUFFER_SIZE];
+	HostContent content;
+
+	// Refuses anything that might escape root
+	const char *makePath (const char* filename) {
+		const char *ret = nullptr;
+
+		if (strstr (filename, "..") == nullptr) {
+			snprintf (path, sizeof (path), "%s/%s", root, filename);
+			ret = path;
+		}
+
+		return ret;
+	}
+
+public:
+	boolean begin (const char* rootDir) {
+		strlcpy (root, rootDir, MAX_URL_LEN);
+
+		struct stat st;
+		return stat (root, &st) == 0 && S_ISDIR (st.st_mode);
+	}
+
+	boolean exists (const char* filename) override {
+		const char *p = makePath (filename);
+
+		struct stat st;
+		return p && stat (p, &st) == 0 && S_ISREG (st.st_mode);
+	}
+
+	Content& get (const char* filename) override {
+		const char *p = makePath (filename);
+		content = HostContent (filename, p ? open (p, O_RDONLY) : -1, readBuffer);
+
+		return content;
+	}
+
+	void release (Content& c) override {
+		static_cast<HostContent&> (c).close ();
+	}
+};
+
+#endif
+
+#endif
@@ -0,0 +1,278 @@
+/***************************************************************************
+ *   This file is part of Webbino                                          *
+ *                                                                         *
+ *   Copyright (C) 2012-2019 by SukkoPera                                  *
+ *                                                                         *
+ *   Webbino is free software: you can redistribute it and/or modify       *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation, either version 3 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   Webbino is distributed in the hope that it will be useful,            *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with Webbino. If not, see <http://www.gnu.org/licenses/>.       *
+ ***************************************************************************/
+
+#ifndef _WEBBINO_JSON_H_
+#define _WEBBINO_JSON_H_
+
+#include <Arduino.h>
+#include <webbino_config.h>
+#include "webbino_debug.h"
+#include "Format.h"
+
+/* Escapes whatever is printed to it, so that it can be put within the quotes
+ * of a JSON string, and passes it on to another Print
+ */
+class JsonEscapePrint: public Print {
+private:
+	Print& out;
+
+	static boolean needsEscape (uint8_t c) {
+		return c == '"' || c == '\\' || c < 0x20;
+	}
+
+	static char hexDigit (uint8_t n) {
+		return n < 10 ? '0' + n : 'a' + n - 10;
+	}
+
+public:
+	explicit JsonEscapePrint (Print& _out): out (_out) {
+	}
+
+	size_t write (uint8_t c) override {
+		if (c == '"' || c == '\\') {
+			out.write ('\\');
+			out.write (c);
+		} else if (c == '\n') {
+			out.print (F("\\n"));
+		} else if (c == '\r') {
+			out.print (F("\\r"));
+		} else if (c == '\t') {
+			out.print (F("\\t"));
+		} else if (c < 0x20) {
+			out.print (F("\\u00"));
+			out.write (hexDigit (c >> 4));
+			out.write (hexDigit (c & 0x0F));
+		} else {
+			out.write (c);
+		}
+
+		return 1;
+	}
+
+	// Passes on runs of characters that need no escaping in one go
+	size_t write (const uint8_t *data, size_t n) override {
+		size_t start = 0;
+		for (size_t i = 0; i < n; ++i) {
+			if (needsEscape (data[i])) {
+				if (i > start)
+					out.write (data + start, i - start);
+				write (data[i]);
+				start = i + 1;
+			}
+		}
+
+		if (n > start)
+			out.write (data + start, n - start);
+
+		return n;
+	}
+
+	using Print::write;
+};
+
+/* Writes JSON straight to a Print (i.e.: a WebClient), taking care of commas,
+ * quoting and escaping, without allocating anything. Keys are best given with
+ * F(), so that they stay in flash. Usage:
+ *   JsonWriter json (client);
+ *   json.beginObject ();
+ *   json.key (F("uptime")).value (millis () / 1000);
+ *   json.key (F("temp")).fixed (tempHundredths, 2);
+ *   json.key (F("relays")).beginArray ();
+ *   for (byte i = 0; i < 8; ++i)
+ *       json.value (relays[i]);
+ *   json.endArray ();
+ *   json.endObject ();
+ *
+ * Up to 16 levels of nesting are supported.
+ */
+class JsonWriter {
+private:
+	Print& out;
+
+	// Bit n is set if the container at depth n already has some element
+	uint16_t notEmpty;
+	byte depth;
+
+	// True right after a key, when a value must follow without a comma
+	boolean afterKey;
+
+	// Writes a comma if needed before a new element
+	void separate () {
+		if (afterKey) {
+			afterKey = false;
+		} else {
+			const uint16_t bit = 1U << (depth & 0x0F);
+			if (notEmpty & bit)
+				out.write (',');
+			notEmpty |= bit;
+		}
+	}
+
+	JsonWriter& begin (char c) {
+		separate ();
+		out.write (c);
+		++depth;
+		notEmpty &= ~(1U << (depth & 0x0F));
+		return *this;
+	}
+
+	JsonWriter& end (char c) {
+		out.write (c);
+		if (depth > 0)
+			--depth;
+		return *this;
+	}
+
+	JsonWriter& number (const char *buf, byte len) {
+		separate ();
+		out.write (buf, len);
+		return *this;
+	}
+
+public:
+	explicit JsonWriter (Print& _out): out (_out), notEmpty (0), depth (0), afterKey (false) {
+	}
+
+	JsonWriter& beginObject () {
+		return begin ('{');
+	}
+
+	JsonWriter& endObject () {
+		return end ('}');
+	}
+
+	JsonWriter& beginArray () {
+		return begin ('[');
+	}
+
+	JsonWriter& endArray () {
+		return end (']');
+	}
+
+	JsonWriter& key (const char *k) {
+		value (k);
+		out.write (':');
+		afterKey = true;
+		return *this;
+	}
+
+#ifdef ENABLE_FLASH_STRINGS
+	JsonWriter& key (WebbinoFStr k) {
+		value (k);
+		out.write (':');
+		afterKey = true;
+		return *this;
+	}
+
+	JsonWriter& value (WebbinoFStr s) {
+		separate ();
+		JsonEscapePrint escaped (out);
+		out.write ('"');
+		escaped.print (s);
+		out.write ('"');
+		return *this;
+	}
+#endif
+
+	// NULL strings are written as null
+	JsonWriter& value (const char *s) {
+		if (s) {
+			separate ();
+			JsonEscapePrint escaped (out);
+			out.write ('"');
+			escaped.print (s);
+			out.write ('"');
+		} else {
+			null ();
+		}
+		return *this;
+	}
+
+	JsonWriter& value (bool b) {
+		separate ();
+		out.print (b ? F("true") : F("false"));
+		return *this;
+	}
+
+	// Where long is wider than 32 bits, Print is left to do the job
+	JsonWriter& value (long n) {
+		if (sizeof (n) > sizeof (int32_t)) {
+			separate ();
+			out.print (n);
+		} else {
+			char buf[FORMAT_BUF_LEN];
+			number (buf, formatSigned (buf, n));
+		}
+		return *this;
+	}
+
+	JsonWriter& value (unsigned long n) {
+		if (sizeof (n) > sizeof (uint32_t)) {
+			separate ();
+			out.print (n);
+		} else {
+			char buf[FORMAT_BUF_LEN];
+			number (buf, formatUnsigned (buf, n));
+		}
+		return *this;
+	}
+
+	JsonWriter& value (int n) {
+		return value (static_cast<long> (n));
+	}
+
+	JsonWriter& value (unsigned int n) {
+		return value (static_cast<unsigned long> (n));
+	}
+
+	/* A fixed-point number with up to 9 decimals, i.e.: fixed (2150, 2) gives
+	 * 21.50
+	 */
+	JsonWriter& fixed (int32_t n, byte decimals) {
+		char buf[FORMAT_BUF_LEN];
+		return number (buf, formatFixed (buf, n, decimals));
+	}
+
+	/* A float, rounded to the given number of decimals (up to 9). Values that
+	 * cannot be represented that way (i.e.: NaN) are written as null.
+	 */
+	JsonWriter& value (double f, byte decimals) {
+		if (decimals > 9)
+			decimals = 9;
+
+		double scaled = f;
+		for (byte i = 0; i < decimals; ++i)
+			scaled *= 10;
+		scaled += scaled < 0 ? -0.5 : 0.5;
+
+		if (scaled > -2147483648.0 && scaled < 2147483647.0)
+			fixed (static_cast<int32_t> (scaled), decimals);
+		else
+			null ();		// Also catches NaN, as comparisons fail
+		return *this;
+	}
+
+	JsonWriter& null () {
+		separate ();
+		out.print (F("null"));
+		return *this;
+	}
+};
+
+#endif
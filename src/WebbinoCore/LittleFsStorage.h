@@ -0,0 +1,146 @@
+/***************************************************************************
+ *   This file is part of Webbino                                          *
+ *                                                                         *
+ *   Copyright (C) 2012-2019 by SukkoPera                                  *
+ *                                                                         *
+ *   Webbino is free software: you can redistribute it and/or modify       *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation, either version 3 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   Webbino is distributed in the hope that it will be useful,            *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with Webbino. If not, see <http://www.gnu.org/licenses/>.       *
+ ***************************************************************************/
+
+#ifndef LITTLEFSSTORAGE_H_INCLUDED
+#define LITTLEFSSTORAGE_H_INCLUDED
+
+#include <Arduino.h>
+#include "Content.h"
+#include "Hash.h"
+#include "webbino_common.h"
+
+#ifdef WEBBINO_ENABLE_LITTLEFS
+
+#if !defined (ESP8266) && !defined (ESP32)
+#error "LittleFS can only be enabled on ESP8266 and ESP32"
+#endif
+
+#include <FS.h>
+#include <LittleFS.h>
+
+struct LittleFsContent: public Content {
+private:
+	File file;
+
+public:
+	LittleFsContent () {
+	}
+
+	LittleFsContent (const char* filename, File& f): Content (filename), file (f) {
+	}
+
+	boolean available () override {
+		return file.available ();
+	}
+
+	byte getNextByte () override {
+		return file.read ();
+	}
+
+	size_t read (byte *buf, size_t len) override {
+		return file.read (buf, len);
+	}
+
+	uint32_t getETag () override {
+		uint32_t etag = 0;
+
+		if (file) {
+			etag = fnv1aDword (FNV_OFFSET_BASIS, file.size ());
+			etag = fnv1aDword (etag, static_cast<uint32_t> (file.getLastWrite ()));
+			if (etag == 0)
+				etag = 1;
+		}
+
+		return etag;
+	}
+
+	unsigned long getSize () override {
+		return file ? file.size () : UNKNOWN_SIZE;
+	}
+
+	boolean seek (unsigned long pos) override {
+		return file && file.seek (pos, SeekSet);
+	}
+
+	void close () {
+		if (file)
+			file.close ();
+	}
+};
+
+/******************************************************************************/
+
+
+/* Since WebServer always calls exists() right before get(), the file opened to
+ * check for existence is kept open and handed over to get(), so that the path
+ * is only looked up once.
+ */
+class LittleFsStorage: public Storage {
+private:
+	LittleFsContent content;
+
+	File probed;
+	char probedName[MAX_URL_LEN];
+
+public:
+	boolean begin () {
+		boolean ret = LittleFS.begin ();
+
+#ifndef WEBBINO_NDEBUG
+		if (!ret) {
+			DPRINTLN (F("Cannot mount LittleFS"));
+		}
+#endif
+
+		return ret;
+	}
+
+	boolean exists (const char* filename) override {
+		if (probed)
+			probed.close ();
+
+		probed = LittleFS.open (filename, "r");
+		if (probed && probed.isDirectory ())
+			probed.close ();
+
+		strlcpy (probedName, filename, MAX_URL_LEN);
+
+		return probed;
+	}
+
+	Content& get (const char* filename) override {
+		if (!probed || strcmp (filename, probedName) != 0) {
+			// Not the one we probed, open it
+			exists (filename);
+		}
+
+		content = LittleFsContent (filename, probed);
+		probed = File ();		// Now owned by content
+
+		return content;
+	}
+
+	void release (Content& c) override {
+		static_cast<LittleFsContent&> (c).close ();
+	}
+};
+
+#endif
+
+#endif
@@ -0,0 +1,307 @@
+/***************************************************************************
+ *   This file is part of Webbino                                          *
+ *                                                                         *
+ *   Copyright (C) 2012-2019 by SukkoPera                                  *
+ *                                                                         *
+ *   Webbino is free software: you can redistribute it and/or modify       *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation, either version 3 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   Webbino is distributed in the hope that it will be useful,            *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with Webbino. If not, see <http://www.gnu.org/licenses/>.       *
+ ***************************************************************************/
+
+#ifndef MAPPEDSTORAGE_H_INCLUDED
+#define MAPPEDSTORAGE_H_INCLUDED
+
+#include <Arduino.h>
+#include "PackedFlashStorage.h"
+#include "webbino_common.h"
+
+// AVRs cannot read flash through plain pointers, use PackedFlashStorage there
+#ifndef ARDUINO_ARCH_AVR
+
+#if defined (ARDUINO_ARCH_ESP32)
+	#include <esp_partition.h>
+	#include <esp_idf_version.h>
+
+	// The mapping API changed a bit with IDF 5
+	#if ESP_IDF_VERSION_MAJOR >= 5
+		typedef esp_partition_mmap_handle_t MapHandle;
+		#define WEBBINO_MMAP_DATA ESP_PARTITION_MMAP_DATA
+		#define webbino_munmap esp_partition_munmap
+	#else
+		typedef spi_flash_mmap_handle_t MapHandle;
+		#define WEBBINO_MMAP_DATA SPI_FLASH_MMAP_DATA
+		#define webbino_munmap spi_flash_munmap
+	#endif
+#elif defined (WEBBINO_ENABLE_HOSTFS)
+	#include <sys/types.h>
+	#include <sys/stat.h>
+	#include <sys/mman.h>
+	#include <fcntl.h>
+	#include <unistd.h>
+#endif
+
+/* A binary image (html2h.py --binary) holds the same stuff as a packed image,
+ * laid out as follows:
+ * - A header (see MappedHeader).
+ * - The index, i.e. nEntries PackedEntry's, sorted by name hash.
+ * - The blob, which all offsets in the index are relative to.
+ *
+ * Everything is little-endian and PackedEntry's are stored the way a 32-bit
+ * CPU would lay them out, so that the index can be used in place.
+ */
+struct MappedHeader {
+	char magic[4];			// "WBPK"
+	uint16_t nEntries;
+	uint16_t reserved;
+};
+
+static_assert (sizeof (PackedEntry) == 24, "PackedEntry layout does not match binary images");
+
+class MappedContent: public Content {
+private:
+	const PackedEntry *entry;
+	const byte *data;
+	uint32_t length;
+	uint32_t offset;
+
+public:
+	MappedContent (): entry (nullptr), data (nullptr), length (0), offset (0) {
+	}
+
+	MappedContent (const char* filename, const byte *blob, const PackedEntry *e):
+		Content (filename), entry (e), data (blob + e -> offset),
+		length (e -> length), offset (0) {
+	}
+
+	boolean available () override {
+		return offset < length;
+	}
+
+	byte getNextByte () override {
+		return data[offset++];
+	}
+
+	size_t read (byte *buf, size_t len) override {
+		if (len > length - offset)
+			len = length - offset;
+
+		memcpy (buf, data + offset, len);
+		offset += len;
+
+		return len;
+	}
+
+	size_t readSpan (const byte*& span, size_t maxLen) override {
+		if (maxLen > length - offset)
+			maxLen = length - offset;
+
+		span = data + offset;
+		offset += maxLen;
+
+		return maxLen;
+	}
+
+	uint32_t getETag () override {
+		return entry -> etag;
+	}
+
+	unsigned long getSize () override {
+		return length;
+	}
+
+	boolean seek (unsigned long pos) override {
+		boolean ret = false;
+
+		if (pos <= length) {
+			offset = pos;
+			ret = true;
+		}
+
+		return ret;
+	}
+
+	PGM_P getContentType () override {
+		return WebServer::getContentTypeById (entry -> mimeId);
+	}
+
+	boolean mayContainTags () override {
+		return entry -> flags & PackedEntry::FLAG_TAGS;
+	}
+};
+
+/******************************************************************************/
+
+
+/* Serves a binary image (html2h.py --binary) that is mapped in memory, so that
+ * files are sent straight from there, without being copied around.
+ *
+ * On the ESP32 the image is stored in a data partition, which is mapped
+ * through the flash cache. Add a partition to your partition table, i.e.:
+ *   webroot, data, 0x40, , 512K,
+ * Then write the image there:
+ *   parttool.py write_partition --partition-name webroot --input site.bin
+ * And finally:
+ *   MappedStorage mappedStorage;
+ *   ...
+ *   mappedStorage.begin ("webroot");
+ *   webserver.addStorage (mappedStorage);
+ *
+ * When running on a PC (see WEBBINO_USE_HOST_SOCKETS), begin() takes the path
+ * of the image file instead.
+ *
+ * Images that are already in memory (i.e.: linked in on a board with
+ * memory-mapped flash) can be served with begin (data, size).
+ */
+class MappedStorage: public Storage {
+private:
+#if defined (ARDUINO_ARCH_ESP32)
+	MapHandle mapHandle;
+#endif
+
+	const void *mapped = nullptr;		// Only set if we did the mapping ourselves
+	size_t mappedSize = 0;
+
+	const PackedEntry *index = nullptr;
+	uint16_t nEntries = 0;
+	const byte *blob = nullptr;
+	MappedContent content;
+
+	const PackedEntry *find (const char* filename) const {
+		const uint32_t hash = fnv1a (FNV_OFFSET_BASIS, filename, strlen (filename));
+
+		// Find the first entry with a matching hash...
+		uint16_t lo = 0, hi = nEntries;
+		while (lo < hi) {
+			uint16_t mid = (lo + hi) / 2;
+			if (index[mid].nameHash < hash)
+				lo = mid + 1;
+			else
+				hi = mid;
+		}
+
+		// ... Then check the name, in case of collisions
+		const PackedEntry *ret = nullptr;
+		for (; !ret && lo < nEntries && index[lo].nameHash == hash; ++lo) {
+			if (strcmp (filename, reinterpret_cast<const char *> (blob + index[lo].nameOffset)) == 0)
+				ret = &index[lo];
+		}
+
+		return ret;
+	}
+
+	void unmap () {
+		if (mapped) {
+#if defined (ARDUINO_ARCH_ESP32)
+			webbino_munmap (mapHandle);
+#elif defined (WEBBINO_ENABLE_HOSTFS)
+			munmap (const_cast<void *> (mapped), mappedSize);
+#endif
+			mapped = nullptr;
+			mappedSize = 0;
+		}
+	}
+
+public:
+	// Note that we check the image is well-formed, but not that it is sane
+	boolean begin (const void *image, size_t size) {
+		const MappedHeader *hdr = reinterpret_cast<const MappedHeader *> (image);
+		boolean ret = false;
+
+		nEntries = 0;
+		if (size < sizeof (MappedHeader) || memcmp (hdr -> magic, "WBPK", 4) != 0) {
+			DPRINTLN (F("Not a Webbino binary image"));
+		} else if (size < sizeof (MappedHeader) + hdr -> nEntries * sizeof (PackedEntry)) {
+			DPRINTLN (F("Binary image is truncated"));
+		} else {
+			index = reinterpret_cast<const PackedEntry *> (hdr + 1);
+			nEntries = hdr -> nEntries;
+			blob = reinterpret_cast<const byte *> (index + nEntries);
+			ret = true;
+
+			DPRINT (F("Files in binary image: "));
+			DPRINTLN (nEntries);
+		}
+
+		return ret;
+	}
+
+#if defined (ARDUINO_ARCH_ESP32)
+	boolean begin (const char* partitionLabel) {
+		boolean ret = false;
+
+		unmap ();
+
+		const esp_partition_t *part = esp_partition_find_first (ESP_PARTITION_TYPE_DATA, ESP_PARTITION_SUBTYPE_ANY, partitionLabel);
+		if (!part) {
+			DPRINTLN (F("Cannot find partition with binary image"));
+		} else if (esp_partition_mmap (part, 0, part -> size, WEBBINO_MMAP_DATA, &mapped, &mapHandle) != ESP_OK) {
+			DPRINTLN (F("Cannot map partition with binary image"));
+			mapped = nullptr;
+		} else {
+			mappedSize = part -> size;
+			ret = begin (mapped, mappedSize);
+		}
+
+		return ret;
+	}
+#elif defined (WEBBINO_ENABLE_HOSTFS)
+	boolean begin (const char* path) {
+		boolean ret = false;
+
+		unmap ();
+
+		int fd = open (path, O_RDONLY);
+		struct stat st;
+		if (fd < 0 || fstat (fd, &st) != 0 || st.st_size == 0) {
+			DPRINTLN (F("Cannot open binary image"));
+		} else {
+			void *p = mmap (nullptr, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+			if (p == MAP_FAILED) {
+				DPRINTLN (F("Cannot map binary image"));
+			} else {
+				mapped = p;
+				mappedSize = st.st_size;
+				ret = begin (mapped, mappedSize);
+			}
+		}
+
+		// The mapping stays valid after closing the file
+		if (fd >= 0)
+			close (fd);
+
+		return ret;
+	}
+#endif
+
+	boolean exists (const char* filename) override {
+		return find (filename) != nullptr;
+	}
+
+	Content& get (const char* filename) override {
+		const PackedEntry *e = find (filename);
+		if (e)
+			content = MappedContent (filename, blob, e);
+		else
+			content = MappedContent ();
+
+		return content;
+	}
+
+	// Pages are fixed
+	boolean canTrackChanges () override {
+		return true;
+	}
+};
+
+#endif
+
+#endif
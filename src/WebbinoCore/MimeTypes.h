@@ -66,6 +66,11 @@ MimeTypeEntry (mt_gz, gz, application, x-gzip);
 
 typedef const MimeType* const MimeTypeArray;
 
+/* NOTE: html2h.py --packed refers to MIME types by their index in this array,
+ * so keep it in sync with the table there when adding new entries. Only ever
+ * add them at the end.
+ */
+
 const MimeTypeArray mimeTypes[] PROGMEM = {
 	&mt_htm,
 	&mt_html,
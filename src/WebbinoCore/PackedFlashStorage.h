@@ -0,0 +1,349 @@
+/***************************************************************************
+ *   This file is part of Webbino                                          *
+ *                                                                         *
+ *   Copyright (C) 2012-2019 by SukkoPera                                  *
+ *                                                                         *
+ *   Webbino is free software: you can redistribute it and/or modify       *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation, either version 3 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   Webbino is distributed in the hope that it will be useful,            *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with Webbino. If not, see <http://www.gnu.org/licenses/>.       *
+ ***************************************************************************/
+
+#ifndef PACKEDFLASHSTORAGE_H_INCLUDED
+#define PACKEDFLASHSTORAGE_H_INCLUDED
+
+#include <Arduino.h>
+#include "Content.h"
+#include "Hash.h"
+#include "WebServer.h"
+#include "webbino_common.h"
+
+/* On AVRs with more than 64 KB of flash (i.e.: the Mega2560), data placed
+ * above the first 64 KB can only be read through 32-bit "far" addresses. These
+ * cannot be used in static initializers, as they can only be obtained at
+ * runtime with pgm_get_far_address().
+ *
+ * The data of far images is placed in the .fini7 section, i.e. after the code,
+ * which leaves the lower 64 KB for the usual PROGMEM stuff.
+ */
+#if defined (ARDUINO_ARCH_AVR) && FLASHEND > 0xFFFFUL
+	#define WEBBINO_FAR_FLASH
+	typedef uint_farptr_t FlashAddr;
+	#define WEBBINO_FAR_PROGMEM __attribute__ ((__section__ (".fini7")))
+	#define WEBBINO_FAR_ADDRESS(var) pgm_get_far_address (var)
+	#define WEBBINO_NEAR_TO_FAR(ptr) static_cast<FlashAddr> (reinterpret_cast<uintptr_t> (ptr))
+	#define flash_read_byte(addr) pgm_read_byte_far (addr)
+	#define flash_memcpy(dest, addr, n) memcpy_PF (dest, addr, n)
+#else
+	typedef PGM_BYTES_P FlashAddr;
+	#define WEBBINO_FAR_PROGMEM PROGMEM
+	#define WEBBINO_FAR_ADDRESS(var) (var)
+	#define WEBBINO_NEAR_TO_FAR(ptr) (ptr)
+	#define flash_read_byte(addr) pgm_read_byte (addr)
+	#define flash_memcpy(dest, addr, n) memcpy_P (dest, addr, n)
+#endif
+
+/* A packed image is a whole website embedded in flash as a single blob, plus
+ * an index with an entry per file. Both are generated by html2h.py --packed.
+ *
+ * The blob holds the (NUL-terminated) file names first, then the contents of
+ * all files, one after the other. Index entries are sorted by the hash of the
+ * file name, so that lookups can use a binary search.
+ */
+struct PackedEntry {
+	uint32_t nameHash;		// FNV-1a
+	uint32_t nameOffset;	// Offsets are relative to the start of the blob
+	uint32_t offset;
+	uint32_t length;
+	uint32_t etag;
+	byte mimeId;			// Index in mimeTypes[], see WebServer::getContentTypeById()
+	byte flags;
+
+	// Set if the file contains TAG_CHAR at least once
+	static const byte FLAG_TAGS = 1 << 0;
+
+	// Methods that (try to) hide the complexity of accessing PROGMEM data
+	uint32_t getNameHash () const {
+		return pgm_read_dword (&(this -> nameHash));
+	}
+
+	uint32_t getNameOffset () const {
+		return pgm_read_dword (&(this -> nameOffset));
+	}
+
+	uint32_t getOffset () const {
+		return pgm_read_dword (&(this -> offset));
+	}
+
+	uint32_t getLength () const {
+		return pgm_read_dword (&(this -> length));
+	}
+
+	uint32_t getETag () const {
+		return pgm_read_dword (&(this -> etag));
+	}
+
+	byte getMimeId () const {
+		return pgm_read_byte (&(this -> mimeId));
+	}
+
+	byte getFlags () const {
+		return pgm_read_byte (&(this -> flags));
+	}
+};
+
+struct PackedImage {
+	PGM_BYTES_P data;			// nullptr for far images
+	const PackedEntry *index;
+	uint16_t nEntries;
+
+	/* Far images (html2h.py --far) are split in chunks of this size, since no
+	 * single object can be bigger than 32 KB on AVRs
+	 */
+	static const uint32_t FAR_CHUNK_SIZE = 16384;
+
+	// Methods that (try to) hide the complexity of accessing PROGMEM data
+	PGM_BYTES_P getData () const {
+		return reinterpret_cast<PGM_BYTES_P> (pgm_read_ptr (&(this -> data)));
+	}
+
+	const PackedEntry *getIndex () const {
+		return reinterpret_cast<const PackedEntry *> (pgm_read_ptr (&(this -> index)));
+	}
+
+	uint16_t getEntryCount () const {
+		return pgm_read_word (&(this -> nEntries));
+	}
+};
+
+/* Gives access to the blob of an image, be it a single near array or a set of
+ * far chunks
+ */
+class PackedBlob {
+private:
+	FlashAddr base;
+	const FlashAddr *chunks;		// nullptr for near images
+
+	FlashAddr addr (uint32_t offset) const {
+		if (chunks)
+			return chunks[offset / PackedImage::FAR_CHUNK_SIZE] + offset % PackedImage::FAR_CHUNK_SIZE;
+		else
+			return base + offset;
+	}
+
+public:
+	PackedBlob (): base (0), chunks (nullptr) {
+	}
+
+	PackedBlob (FlashAddr _base): base (_base), chunks (nullptr) {
+	}
+
+	PackedBlob (const FlashAddr *_chunks): base (0), chunks (_chunks) {
+	}
+
+	byte readByte (uint32_t offset) const {
+		return flash_read_byte (addr (offset));
+	}
+
+	void read (byte *buf, uint32_t offset, size_t len) const {
+		while (len > 0) {
+			// Don't cross chunk boundaries
+			size_t n = len;
+			if (chunks) {
+				uint32_t left = PackedImage::FAR_CHUNK_SIZE - offset % PackedImage::FAR_CHUNK_SIZE;
+				if (n > left)
+					n = left;
+			}
+
+			flash_memcpy (buf, addr (offset), n);
+			buf += n;
+			offset += n;
+			len -= n;
+		}
+	}
+
+	// Same as strcmp(), but s2 is in the blob
+	int compare (const char* s1, uint32_t offset2) const {
+		byte c1, c2;
+
+		do {
+			c1 = *s1++;
+			c2 = readByte (offset2++);
+		} while (c1 != '\0' && c1 == c2);
+
+		return c1 - c2;
+	}
+};
+
+/******************************************************************************/
+
+
+class PackedContent: public Content {
+private:
+	const PackedEntry *entry;
+	const PackedBlob *blob;
+	uint32_t start;
+	uint32_t length;
+	uint32_t offset;
+
+public:
+	PackedContent (): entry (nullptr), blob (nullptr), start (0), length (0), offset (0) {
+	}
+
+	PackedContent (const char* filename, const PackedBlob *b, const PackedEntry *e):
+		Content (filename), entry (e), blob (b), start (e -> getOffset ()),
+		length (e -> getLength ()), offset (0) {
+	}
+
+	boolean available () override {
+		return offset < length;
+	}
+
+	byte getNextByte () override {
+		return blob -> readByte (start + offset++);
+	}
+
+	size_t read (byte *buf, size_t len) override {
+		if (len > length - offset)
+			len = length - offset;
+
+		blob -> read (buf, start + offset, len);
+		offset += len;
+
+		return len;
+	}
+
+	uint32_t getETag () override {
+		return entry -> getETag ();
+	}
+
+	unsigned long getSize () override {
+		return length;
+	}
+
+	boolean seek (unsigned long pos) override {
+		boolean ret = false;
+
+		if (pos <= length) {
+			offset = pos;
+			ret = true;
+		}
+
+		return ret;
+	}
+
+	PGM_P getContentType () override {
+		return WebServer::getContentTypeById (entry -> getMimeId ());
+	}
+
+	boolean mayContainTags () override {
+		return entry -> getFlags () & PackedEntry::FLAG_TAGS;
+	}
+};
+
+/******************************************************************************/
+
+
+/* Serves a packed image. Usage:
+ *   #include "site.h"		// Generated by html2h.py --packed
+ *   PackedFlashStorage flashStorage;
+ *   ...
+ *   flashStorage.begin (&site);
+ *   webserver.addStorage (flashStorage);
+ *
+ * Far images (html2h.py --far) need the addresses of their chunks, which can
+ * only be obtained at runtime, i.e. in setup():
+ *   #include "site.h"
+ *   FlashAddr siteChunks[site_FAR_CHUNK_COUNT];
+ *   ...
+ *   site_fillFarChunks (siteChunks);
+ *   flashStorage.begin (&site, siteChunks);
+ */
+class PackedFlashStorage: public Storage {
+private:
+	PackedBlob blob;
+	const PackedEntry *index = nullptr;
+	uint16_t nEntries = 0;
+	PackedContent content;
+
+	const PackedEntry *find (const char* filename) const {
+		const uint32_t hash = fnv1a (FNV_OFFSET_BASIS, filename, strlen (filename));
+
+		// Find the first entry with a matching hash...
+		uint16_t lo = 0, hi = nEntries;
+		while (lo < hi) {
+			uint16_t mid = (lo + hi) / 2;
+			if (index[mid].getNameHash () < hash)
+				lo = mid + 1;
+			else
+				hi = mid;
+		}
+
+		// ... Then check the name, in case of collisions
+		const PackedEntry *ret = nullptr;
+		for (; !ret && lo < nEntries && index[lo].getNameHash () == hash; ++lo) {
+			if (blob.compare (filename, index[lo].getNameOffset ()) == 0)
+				ret = &index[lo];
+		}
+
+		return ret;
+	}
+
+	void setIndex (const PackedImage *image) {
+		index = image -> getIndex ();
+		nEntries = image -> getEntryCount ();
+
+#ifndef WEBBINO_NDEBUG
+		DPRINTLN (F("Pages available in packed image:"));
+		for (uint16_t i = 0; i < nEntries; ++i) {
+			DPRINT (i);
+			DPRINT (F(". "));
+
+			char c;
+			for (uint32_t o = index[i].getNameOffset (); (c = blob.readByte (o)); ++o)
+				DPRINT (c);
+			DPRINTLN ();
+		}
+#endif
+	}
+
+public:
+	void begin (const PackedImage *image) {
+		blob = PackedBlob (WEBBINO_NEAR_TO_FAR (image -> getData ()));
+		setIndex (image);
+	}
+
+	void begin (const PackedImage *image, const FlashAddr chunks[]) {
+		blob = PackedBlob (chunks);
+		setIndex (image);
+	}
+
+	boolean exists (const char* filename) override {
+		return find (filename) != nullptr;
+	}
+
+	Content& get (const char* filename) override {
+		const PackedEntry *e = find (filename);
+		if (e)
+			content = PackedContent (filename, &blob, e);
+		else
+			content = PackedContent ();
+
+		return content;
+	}
+
+	// Pages are fixed
+	boolean canTrackChanges () override {
+		return true;
+	}
+};
+
+#endif
@@ -19,6 +19,7 @@
 
 #include <Arduino.h>
 #include "Content.h"
+#include "Hash.h"
 #include "webbino_common.h"
 
 #if defined (WEBBINO_ENABLE_SD) || defined (WEBBINO_ENABLE_SDFAT)
@@ -31,20 +32,114 @@
 static SdFat SD;
 #endif
 
+#if defined (WEBBINO_SDFAT_RAW_READS) && !defined (SD_FAT_VERSION_STR)
+#error "WEBBINO_SDFAT_RAW_READS requires WEBBINO_ENABLE_SDFAT and SdFat 2.x"
+#endif
+
 struct SdContent: public Content {
 private:
 	File file;
 
+	/* Reading a byte at a time from the SD libraries is slow, so we read data
+	 * in blocks. Blocks never cross a multiple of SD_READ_BUFSIZE, so that
+	 * they stay sector-aligned. The buffer belongs to SdStorage.
+	 */
+	byte *buf;
+	uint16_t bufLen;
+	uint16_t bufPos;
+
+#ifdef WEBBINO_SDFAT_RAW_READS
+	static const uint16_t SECTOR_SIZE = 512;
+
+	// Only valid if rawState == RAW_OK
+	uint32_t firstSector;
+
+	enum RawState {
+		RAW_UNKNOWN,
+		RAW_OK,
+		RAW_IMPOSSIBLE
+	} rawState;
+
+	/* Reads whole sectors straight from the card, bypassing the filesystem.
+	 * This is only possible for files that are stored contiguously, which
+	 * most files copied to a freshly-formatted card are.
+	 */
+	size_t readRaw (byte *dst, size_t len) {
+		size_t ret = 0;
+
+		if (rawState == RAW_UNKNOWN) {
+			uint32_t lastSector;
+			rawState = file.contiguousRange (&firstSector, &lastSector) ? RAW_OK : RAW_IMPOSSIBLE;
+		}
+
+		const uint32_t pos = file.position ();
+		if (rawState == RAW_OK && pos % SECTOR_SIZE == 0) {
+			uint32_t left = file.size () - pos;
+			if (len < left)
+				left = len;
+
+			const uint32_t nSectors = left / SECTOR_SIZE;
+			if (nSectors > 0 && SD.card () -> readSectors (firstSector + pos / SECTOR_SIZE, dst, nSectors)) {
+				ret = nSectors * SECTOR_SIZE;
+				file.seek (pos + ret);
+			}
+		}
+
+		return ret;
+	}
+#endif
+
+	size_t readDirect (byte *dst, size_t len) {
+		size_t ret = 0;
+
+#ifdef WEBBINO_SDFAT_RAW_READS
+		ret = readRaw (dst, len);
+#endif
+		if (ret == 0) {
+			int n = file.read (dst, len);
+			if (n > 0)
+				ret = n;
+		}
+
+		return ret;
+	}
+
+	boolean fill () {
+		bufLen = readDirect (buf, SD_READ_BUFSIZE - file.position () % SD_READ_BUFSIZE);
+		bufPos = 0;
+
+		return bufLen > 0;
+	}
+
+	void copyFrom (const SdContent& o) {
+		file = o.file;
+		buf = o.buf;
+		bufLen = o.bufLen;
+		bufPos = o.bufPos;
+#ifdef WEBBINO_SDFAT_RAW_READS
+		firstSector = o.firstSector;
+		rawState = o.rawState;
+#endif
+	}
+
 public:
-	SdContent () {
+	SdContent (): buf (nullptr), bufLen (0), bufPos (0) {
+#ifdef WEBBINO_SDFAT_RAW_READS
+		rawState = RAW_IMPOSSIBLE;
+#endif
 	}
 
-	SdContent (const char* filename): Content (filename) {
+	SdContent (const char* filename, byte *_buf): Content (filename), buf (_buf),
+		bufLen (0), bufPos (0) {
+
 		file = SD.open (filename);
+#ifdef WEBBINO_SDFAT_RAW_READS
+		rawState = RAW_UNKNOWN;
+#endif
 	}
 
-	SdContent (const SdContent& o): Content (*this) {
-		file = o.file;
+	SdContent (const SdContent& o): Content (o) {
+		copyFrom (o);
 	}
 
 	SdContent& operator= (SdContent o) {
@@ -54,7 +149,7 @@ public:
 		Content::operator= (o);		// This must be called explicitly!!!
 
 		//~ mystd::swap (*this, o);
-		file = o.file;
+		copyFrom (o);
 		return *this;
 	}
 
@@ -63,12 +158,81 @@ public:
 			file.close ();
 	}
 
+	boolean isOpen () {
+		return file;
+	}
+
 	boolean available () override {
-		return file.available ();
+		return bufPos < bufLen || file.available ();
 	}
 
 	byte getNextByte () override {
-		return file.read ();
+		byte b = 0xFF;		// Same as File::read() at EOF
+
+		if (bufPos < bufLen || fill ())
+			b = buf[bufPos++];
+
+		return b;
+	}
+
+	size_t read (byte *dst, size_t len) override {
+		size_t n = 0;
+
+		// First use up what's left in the buffer
+		if (bufPos < bufLen) {
+			n = bufLen - bufPos;
+			if (len < n)
+				n = len;
+
+			memcpy (dst, buf + bufPos, n);
+			bufPos += n;
+		}
+
+		if (n < len) {
+			// Read as many whole blocks as possible straight into dst...
+			const size_t blocks = (len - n) / SD_READ_BUFSIZE * SD_READ_BUFSIZE;
+			if (blocks > 0)
+				n += readDirect (dst + n, blocks);
+
+			// ... And what's left through the buffer
+			if (n < len && bufPos >= bufLen && fill ()) {
+				size_t m = len - n;
+				if (bufLen < m)
+					m = bufLen;
+
+				memcpy (dst + n, buf, m);
+				bufPos = m;
+				n += m;
+			}
+		}
+
+		return n;
+	}
+
+	uint32_t getETag () override {
+		uint32_t etag = 0;
+
+#ifdef WEBBINO_ENABLE_SDFAT
+		// The SD library gives no access to timestamps, so we can only do this with SdFat
+		uint16_t date, time;
+		if (file && file.getModifyDateTime (&date, &time)) {
+			etag = fnv1aDword (FNV_OFFSET_BASIS, file.size ());
+			etag = fnv1aDword (etag, (static_cast<uint32_t> (date) << 16) | time);
+			if (etag == 0)
+				etag = 1;
+		}
+#endif
+
+		return etag;
+	}
+
+	unsigned long getSize () override {
+		return file ? file.size () : UNKNOWN_SIZE;
+	}
+
+	boolean seek (unsigned long pos) override {
+		bufLen = bufPos = 0;
+		return file && file.seek (pos);
 	}
 };
 
@@ -78,6 +242,96 @@ public:
 class SdStorage: public Storage {
 private:
 	SdContent content;
+	byte readBuffer[SD_READ_BUFSIZE];
+	uint32_t generation = 0;
+
+	// Set if exists() already opened the file get() will be asked for
+	boolean preopened = false;
+
+#ifdef WEBBINO_SD_INDEX_SIZE
+	/* Sorted hashes of the paths of all the files on the card, so that we can
+	 * tell if a file exists without talking to the card. Hashes are computed
+	 * on normalized paths, see hashPath().
+	 */
+	uint32_t index[WEBBINO_SD_INDEX_SIZE];
+	uint16_t indexLen = 0;
+	boolean indexValid = false;
+	boolean indexComplete = false;		// False if the card had more files than would fit
+
+	/* FAT is case-insensitive, so we make the hash so as well. Also take care
+	 * of repeated slashes and make sure there is a leading one.
+	 */
+	static uint32_t hashPath (const char* path) {
+		uint32_t hash = fnv1a (FNV_OFFSET_BASIS, static_cast<byte> ('/'));
+		char prev = '/';
+
+		for (; *path; ++path) {
+			char c = tolower (*path);
+			if (c != '/' || prev != '/')
+				hash = fnv1a (hash, static_cast<byte> (c));
+			prev = c;
+		}
+
+		return hash;
+	}
+
+	boolean indexFind (uint32_t hash) const {
+		uint16_t lo = 0, hi = indexLen;
+
+		while (lo < hi) {
+			uint16_t mid = (lo + hi) / 2;
+			if (index[mid] < hash)
+				lo = mid + 1;
+			else
+				hi = mid;
+		}
+
+		return lo < indexLen && index[lo] == hash;
+	}
+
+	void indexAdd (uint32_t hash) {
+		if (indexLen >= WEBBINO_SD_INDEX_SIZE) {
+			indexComplete = false;
+		} else {
+			// Keep it sorted, insertion sort is fine for the sizes we deal with
+			uint16_t i = indexLen++;
+			for (; i > 0 && index[i - 1] > hash; --i)
+				index[i] = index[i - 1];
+			index[i] = hash;
+		}
+	}
+
+	// path contains the path of dir, including a trailing slash
+	void indexDir (File& dir, char* path, size_t pathLen) {
+		File entry;
+
+#ifdef WEBBINO_ENABLE_SDFAT
+		while (entry.openNext (&dir, O_RDONLY)) {
+			entry.getName (path + pathLen, MAX_URL_LEN - pathLen);
+			const boolean isDir = entry.isDir ();
+#else
+		while ((entry = dir.openNextFile ())) {
+			strlcpy (path + pathLen, entry.name (), MAX_URL_LEN - pathLen);
+			const boolean isDir = entry.isDirectory ();
+#endif
+			size_t len = strlen (path);
+			if (!isDir) {
+				DPRINT (F("- "));
+				DPRINTLN (path);
+
+				indexAdd (hashPath (path));
+			} else if (len < MAX_URL_LEN - 2) {
+				path[len++] = '/';
+				path[len] = '\0';
+				indexDir (entry, path, len);
+			}
+
+			entry.close ();
+		}
+
+		path[pathLen] = '\0';
+	}
+#endif
 
 public:
 	boolean begin (int8_t pin) {
@@ -89,17 +343,89 @@ public:
 		} else {
 			DPRINTLN (F(" done"));
 			ret = true;
+			++generation;
+
+#ifdef WEBBINO_SD_INDEX_SIZE
+			refreshIndex ();
+#endif
 		}
 
 		return ret;
 	}
 
+#ifdef WEBBINO_SD_INDEX_SIZE
+	/* (Re)builds the index of the files on the card. Call this whenever files
+	 * are added or removed. Returns false if not all files could be indexed, in
+	 * which case lookups of files that are not in the index will still hit the
+	 * card.
+	 */
+	boolean refreshIndex () {
+		DPRINTLN (F("Indexing SD card contents:"));
+
+		indexLen = 0;
+		indexComplete = true;
+		++generation;
+
+		char path[MAX_URL_LEN] = "/";
+		File root = SD.open (path);
+		indexValid = root;
+		if (indexValid) {
+			indexDir (root, path, 1);
+			root.close ();
+		} else {
+			indexComplete = false;
+		}
+
+		DPRINT (F("Indexed files: "));
+		DPRINT (indexLen);
+		if (!indexComplete) {
+			DPRINT (F(" (Incomplete)"));
+		}
+		DPRINTLN ();
+
+		return indexComplete;
+	}
+#endif
+
+	uint32_t getGeneration () override {
+		return generation;
+	}
+
+	// Only refreshIndex() tells that files changed
+	boolean canTrackChanges () override {
+#ifdef WEBBINO_SD_INDEX_SIZE
+		return true;
+#else
+		return false;
+#endif
+	}
+
 	boolean exists (const char* filename) override {
+#ifdef WEBBINO_SD_INDEX_SIZE
+		boolean ret = false;
+		if (indexValid && indexFind (hashPath (filename))) {
+			/* The index only holds hashes, so make sure this is not a
+			 * collision by opening the file, which get() will need anyway
+			 */
+			content = SdContent (filename, readBuffer);
+			ret = preopened = content.isOpen ();
+		}
+
+		if (!ret && !indexComplete) {
+			// Might be one that did not fit in the index
+			ret = SD.exists (filename);
+		}
+
+		return ret;
+#else
 		return SD.exists (filename);
+#endif
 	}
 
 	Content& get (const char* filename) override {
-		content = SdContent (filename);
+		if (!preopened || strcmp (content.getFilename (), filename) != 0)
+			content = SdContent (filename, readBuffer);
+		preopened = false;
 
 		return content;
 	}
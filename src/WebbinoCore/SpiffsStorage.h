@@ -19,6 +19,7 @@
 
 #include <Arduino.h>
 #include "Content.h"
+#include "Hash.h"
 #include "webbino_common.h"
 
 #ifdef WEBBINO_ENABLE_SPIFFS
@@ -58,6 +59,31 @@ public:
 	byte getNextByte () override {
 		return file.read ();
 	}
+
+	size_t read (byte *buf, size_t len) override {
+		return file.read (buf, len);
+	}
+
+	uint32_t getETag () override {
+		uint32_t etag = 0;
+
+		if (file) {
+			etag = fnv1aDword (FNV_OFFSET_BASIS, file.size ());
+			etag = fnv1aDword (etag, static_cast<uint32_t> (file.getLastWrite ()));
+			if (etag == 0)
+				etag = 1;
+		}
+
+		return etag;
+	}
+
+	unsigned long getSize () override {
+		return file ? file.size () : UNKNOWN_SIZE;
+	}
+
+	boolean seek (unsigned long pos) override {
+		return file && file.seek (pos, SeekSet);
+	}
 };
 
 /******************************************************************************/
@@ -23,6 +23,19 @@
 class Content;
 
 class Storage {
+private:
+	friend class WebServer;
+
+	/* WebServer keeps its storages in a linked list, so that there is no
+	 * limit on how many can be added. This means a storage can only be added
+	 * once, to a single WebServer.
+	 */
+	Storage* nextStorage = nullptr;
+
+	// URL prefix the storage is mounted at, nullptr if not mounted
+	const char* mountPoint = nullptr;
+	byte mountLen = 0;
+
 public:
 	virtual boolean exists (const char* filename) = 0;
 
@@ -31,6 +44,22 @@ public:
 	virtual void release (Content& content) {
 		(void) content;
 	}
+
+	/* Storages whose set of files can change at runtime can return a value
+	 * here that changes every time this happens. WebServer uses it to know
+	 * when what it remembers about which files are where is no longer valid.
+	 */
+	virtual uint32_t getGeneration () {
+		return 0;
+	}
+
+	/* Returns true if getGeneration() changes whenever files are added or
+	 * removed, or if this never happens. Only then can WebServer remember that
+	 * a file is not there.
+	 */
+	virtual boolean canTrackChanges () {
+		return false;
+	}
 };
 
 #endif
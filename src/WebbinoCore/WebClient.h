@@ -30,6 +30,12 @@ protected:
 	byte buf[CLIENT_BUFSIZE];
 	size_t avail;
 
+	// Set when detach() gave the connection to another client
+	boolean detached = false;
+
+	// Set on a client that got a connection from detach(), until close()
+	boolean kept = false;
+
 	void flushBuffer () {
 		if (avail > 0) {
 			//~ DPRINT (F("Flushing "));
@@ -61,6 +67,7 @@ public:
 	virtual void begin (char* req) {
 		request.parse (req);
 		avail = 0;
+		detached = false;
 	}
 
 	virtual size_t write (uint8_t c) override {
@@ -73,9 +80,45 @@ public:
 		return 1;
 	}
 
+	virtual size_t write (const uint8_t *data, size_t n) override {
+		if (n >= CLIENT_BUFSIZE) {
+			// No point in copying this to the buffer, send it straight away
+			flushBuffer ();
+			doWrite (data, n);		// FIXME: Same as in flushBuffer()
+		} else {
+			for (size_t i = 0; i < n; ++i)
+				write (data[i]);
+		}
+
+		return n;
+	}
+
+	using Print::write;
+
+	// Sends what is in the buffer right away
+	void flush () {
+		flushBuffer ();
+	}
+
 	virtual void sendReply () {
 		flushBuffer ();
 	}
+
+	/* Interfaces that can keep a connection open once the request has been
+	 * handled (see EventStream) override the following. detach() hands the
+	 * connection over to another client, which keeps it until close() is
+	 * called, and returns it. It returns NULL if there is no room for more.
+	 */
+	virtual WebClient* detach () {
+		return nullptr;
+	}
+
+	virtual boolean connected () {
+		return false;
+	}
+
+	virtual void close () {
+	}
 };
 
 #endif
@@ -21,6 +21,10 @@
 #include "WebClient.h"
 #include "Content.h"
 #include "MimeTypes.h"
+#include "Hash.h"
+#include "Format.h"
+#include "Json.h"
+#include "EventStream.h"
 #include "webbino_debug.h"
 
 
@@ -31,13 +35,111 @@
 #define OK_HEADER "200 OK\r\n"		// \r\nPragma: no-cache
 #define CONT_TYPE_HEADER "Content-Type: "
 #define NOT_FOUND_HEADER "404 Not Found\r\nContent-Type: text/html"
+#define NOT_MODIFIED_HEADER "304 Not Modified\r\n"
+#define PARTIAL_HEADER "206 Partial Content\r\n"
+#define NOT_SATISFIABLE_HEADER "416 Range Not Satisfiable\r\nContent-Range: bytes */"
+#define ACCEPT_RANGES_HEADER "Accept-Ranges: bytes"
+#define CONT_RANGE_HEADER "Content-Range: bytes "
+#define ETAG_HEADER "ETag: "
 #define HEADER_END "\r\n\r\n"
+#define JSON_CONT_TYPE "application/json"
+#define EVENT_STREAM_HEADER "Content-Type: text/event-stream\r\nCache-Control: no-cache"
+#define UNAVAILABLE_HEADER "503 Service Unavailable"
+
+// Length of a formatted ETag, i.e.: "01234567" (quotes included), plus terminator
+#define ETAG_STR_LEN 11
+
+
+// Formats an ETag the way it is sent to clients
+static void formatETag (char *buf, uint32_t etag) {
+	buf[0] = '"';
+	for (byte i = 0; i < 8; ++i) {
+		byte nibble = (etag >> (28 - i * 4)) & 0x0F;
+		buf[i + 1] = nibble < 10 ? '0' + nibble : 'a' + nibble - 10;
+	}
+	buf[9] = '"';
+	buf[10] = '\0';
+}
+
+// Checks if the client already has the content with the given ETag
+static boolean etagMatches (const HTTPRequestParser& request, const char *etagStr) {
+	return (request.ifNoneMatch[0] == '*' && request.ifNoneMatch[1] == '\0') ||
+		   strstr (request.ifNoneMatch, etagStr) != NULL;
+}
+
+// Tells the client that its copy of the content is up-to-date
+static void sendNotModified (Print& out, const char *etagStr) {
+	DPRINTLN (F("Content not modified"));
+
+	out.print (F(HEADER_START NOT_MODIFIED_HEADER ETAG_HEADER));
+	out.print (etagStr);
+	out.print (F(HEADER_END));
+}
+
+#if defined (ENABLE_TAGS) && (defined (RENDER_CACHE_SLOTS) || defined (TAG_PAGE_ETAGS))
+// Headers for a whole page of unknown size, etagStr can be NULL
+static void sendPageHeaders (Print& out, PGM_P contType, const char *etagStr) {
+	out.print (F(HEADER_START OK_HEADER CONT_TYPE_HEADER));
+	out.print (PSTR_TO_F (contType));
+	if (etagStr) {
+		out.print (F("\r\n" ETAG_HEADER));
+		out.print (etagStr);
+	}
+	out.print (F(HEADER_END));
+}
+#endif
+
+#if defined (ENABLE_TAGS) && defined (TAG_PAGE_ETAGS)
+// Only hashes whatever is printed to it
+class HashPrint: public Print {
+private:
+	uint32_t hash;
+
+public:
+	HashPrint (): hash (FNV_OFFSET_BASIS) {
+	}
+
+	size_t write (uint8_t c) override {
+		return write (&c, 1);
+	}
+
+	size_t write (const uint8_t *data, size_t n) override {
+		hash = fnv1a (hash, data, n);
+		return n;
+	}
+
+	using Print::write;
+
+	uint32_t getHash () const {
+		return hash != 0 ? hash : 1;		// 0 means "no ETag"
+	}
+};
+#endif
 
 
 boolean WebServer::begin (NetworkInterface& _netint) {
-	nStorage = 0;
+	storages = nullptr;
+	mounts = nullptr;
 	netint = &_netint;
 
+#ifdef MAX_EVENT_SUBSCRIBERS
+	eventStreams = nullptr;
+#endif
+
+#ifdef LOOKUP_CACHE_SIZE
+	invalidateLookupCache ();
+#endif
+
+#if defined (ENABLE_TAGS) && defined (TAG_INDEX_SLOTS)
+	for (byte i = 0; i < TAG_INDEX_SLOTS; ++i)
+		tagIndex[i].lastUse = 0;
+#endif
+
+#if defined (ENABLE_TAGS) && defined (RENDER_CACHE_SLOTS)
+	for (byte i = 0; i < RENDER_CACHE_SLOTS; ++i)
+		renderCache[i].valid = false;
+#endif
+
 #ifndef WEBBINO_NDEBUG
 	DPRINTLN (F("Available MIME Types:"));
 	const MimeType* mt;
@@ -70,6 +172,104 @@ void WebServer::enableReplacementTags (const ReplacementTag* const _substitution
 #endif
 
 
+#ifdef ENABLE_TAGS
+// Prints the variable a tag is bound to
+static void printTagVariable (Print& out, const ReplacementTag* tag) {
+	const void *var = tag -> getData ();
+	char buf[FORMAT_BUF_LEN];
+
+	switch (tag -> getVarType ()) {
+		case TAGVAR_BOOL:
+			out.print (*reinterpret_cast<const boolean *> (var) ? '1' : '0');
+			break;
+		case TAGVAR_UINT16:
+			out.write (buf, formatUnsigned (buf, *reinterpret_cast<const uint16_t *> (var)));
+			break;
+		case TAGVAR_INT32:
+			out.write (buf, formatSigned (buf, *reinterpret_cast<const int32_t *> (var)));
+			break;
+		case TAGVAR_FIXED:
+			out.write (buf, formatFixed (buf, *reinterpret_cast<const int32_t *> (var), tag -> getVarDecimals ()));
+			break;
+		case TAGVAR_STRING:
+			out.print (*reinterpret_cast<const char * const *> (var));
+			break;
+		default:
+			break;
+	}
+}
+
+void CachedTag::refresh () {
+	PString pstr (value, CACHED_TAG_LEN);
+
+	TagArgFn argFn = tag -> getArgFunction ();
+	TagStreamFn streamFn = tag -> getStreamFunction ();
+	if (argFn) {
+		argFn (pstr, "", tag -> getData ());
+	} else if (streamFn) {
+		streamFn (pstr, tag -> getData ());
+	} else if (tag -> getVarType () != TAGVAR_NONE) {
+		printTagVariable (pstr, tag);
+	} else {
+		PString& rep = (tag -> getFunction ()) (tag -> getData ());
+		pstr.print (rep);
+		rep.begin ();
+	}
+
+	lastRefresh = millis ();
+
+	DPRINT (F("Refreshed cached tag "));
+	DPRINT (PSTR_TO_F (tag -> getName ()));
+	DPRINT (F(": \""));
+	DPRINT (value);
+	DPRINTLN (F("\""));
+}
+
+boolean WebServer::addCachedTag (CachedTag& cachedTag) {
+	boolean ret = false;
+
+	if (!findCachedTag (cachedTag.tag)) {
+		cachedTag.refresh ();
+		cachedTag.next = cachedTags;
+		cachedTags = &cachedTag;
+		ret = true;
+	}
+
+	return ret;
+}
+
+const CachedTag* WebServer::findCachedTag (const ReplacementTag* tag) const {
+	const CachedTag* ret = nullptr;
+
+	for (const CachedTag* ct = cachedTags; !ret && ct; ct = ct -> next) {
+		if (ct -> tag == tag)
+			ret = ct;
+	}
+
+	return ret;
+}
+
+boolean WebServer::refreshCachedTags () {
+	const unsigned long now = millis ();
+	CachedTag* stalest = nullptr;
+	unsigned long overdue = 0;
+
+	for (CachedTag* ct = cachedTags; ct; ct = ct -> next) {
+		const unsigned long age = now - ct -> lastRefresh;
+		if (age >= ct -> maxAge && (!stalest || age - ct -> maxAge >= overdue)) {
+			stalest = ct;
+			overdue = age - ct -> maxAge;
+		}
+	}
+
+	// Only one at a time, so that clients don't have to wait too long
+	if (stalest)
+		stalest -> refresh ();
+
+	return stalest != nullptr;
+}
+#endif
+
 #ifdef ENABLE_PAGE_FUNCTIONS
 void WebServer::associateFunctions (FileFuncAssociationArray* _associations) {
 	associations = _associations;
@@ -95,17 +295,207 @@ void WebServer::associateFunctions (FileFuncAssociationArray* _associations) {
 }
 #endif
 
+#ifdef MAX_EVENT_SUBSCRIBERS
+boolean WebServer::addEventStream (EventStream& stream) {
+	boolean ret = true;
+
+	for (EventStream* es = eventStreams; ret && es; es = es -> next)
+		ret = es != &stream;
+
+	if (ret) {
+		stream.next = eventStreams;
+		eventStreams = &stream;
+	}
+
+	return ret;
+}
+
+void WebServer::pruneEventStreams () {
+	for (EventStream* es = eventStreams; es; es = es -> next)
+		es -> prune ();
+}
+
+boolean WebServer::handleEventStream (WebClient& client) {
+	EventStream* stream = eventStreams;
+	while (stream && strcmp (client.request.get_basename (), stream -> getPath ()) != 0)
+		stream = stream -> next;
+
+	if (stream) {
+		if (client.request.method == HTTPRequestParser::METHOD_HEAD) {
+			client.print (F(HEADER_START OK_HEADER EVENT_STREAM_HEADER HEADER_END));
+		} else {
+			// Subscribers that went away might be taking up the room we need
+			pruneEventStreams ();
+
+			WebClient* sub = nullptr;
+			if (stream -> getSubscriberCount () < MAX_EVENT_SUBSCRIBERS)
+				sub = client.detach ();
+
+			if (sub) {
+				DPRINT (F("New subscriber of "));
+				DPRINTLN (stream -> getPath ());
+				sub -> print (F(HEADER_START OK_HEADER EVENT_STREAM_HEADER HEADER_END));
+				sub -> flush ();
+				stream -> addSubscriber (sub);
+			} else {
+				DPRINTLN (F("No room for more subscribers"));
+				client.print (F(HEADER_START UNAVAILABLE_HEADER HEADER_END));
+			}
+		}
+	}
+
+	return stream != nullptr;
+}
+#endif
+
+boolean WebServer::isAdded (const Storage& storage) const {
+	boolean ret = false;
+
+	for (Storage* s = storages; !ret && s; s = s -> nextStorage)
+		ret = s == &storage;
+
+	for (Storage* s = mounts; !ret && s; s = s -> nextStorage)
+		ret = s == &storage;
+
+	return ret;
+}
+
 boolean WebServer::addStorage (Storage& storage) {
 	boolean ret = false;
 
-	if (nStorage < MAX_STORAGES) {
-		storages[nStorage++] = &storage;
+	if (!isAdded (storage)) {
+		// Append, since order matters
+		Storage** p = &storages;
+		while (*p)
+			p = &((*p) -> nextStorage);
+
+		storage.nextStorage = nullptr;
+		*p = &storage;
 		ret = true;
+
+#ifdef LOOKUP_CACHE_SIZE
+		// Pages that were not found might be on the new storage
+		invalidateLookupCache ();
+#endif
 	}
 
 	return ret;
 }
 
+boolean WebServer::mountStorage (const char* prefix, Storage& storage) {
+	boolean ret = false;
+
+	if (prefix && prefix[0] == '/' && !isAdded (storage)) {
+		// We don't care about trailing slashes, "/" thus becomes ""
+		size_t len = strlen (prefix);
+		while (len > 0 && prefix[len - 1] == '/')
+			--len;
+
+		storage.mountPoint = prefix;
+		storage.mountLen = len;
+
+		// Keep the list sorted by decreasing length, so the first match is the longest
+		Storage** p = &mounts;
+		while (*p && (*p) -> mountLen >= len)
+			p = &((*p) -> nextStorage);
+
+		storage.nextStorage = *p;
+		*p = &storage;
+		ret = true;
+
+		DPRINT (F("Storage mounted at "));
+		DPRINTLN (prefix);
+	}
+
+	return ret;
+}
+
+Storage* WebServer::findMount (const char* pagename) const {
+	Storage* ret = nullptr;
+
+	for (Storage* s = mounts; !ret && s; s = s -> nextStorage) {
+		if (strncmp (pagename, s -> mountPoint, s -> mountLen) == 0 && pagename[s -> mountLen] == '/')
+			ret = s;
+	}
+
+	return ret;
+}
+
+#ifdef LOOKUP_CACHE_SIZE
+uint32_t WebServer::getStoragesGeneration () const {
+	uint32_t gen = 0;
+
+	for (Storage* s = storages; s; s = s -> nextStorage)
+		gen += s -> getGeneration ();
+
+	return gen;
+}
+
+boolean WebServer::canCacheMisses () const {
+	boolean ret = true;
+
+	for (Storage* s = storages; ret && s; s = s -> nextStorage)
+		ret = s -> canTrackChanges ();
+
+	return ret;
+}
+
+void WebServer::invalidateLookupCache () {
+	for (byte i = 0; i < LOOKUP_CACHE_SIZE; ++i)
+		lookupCache[i].used = false;
+
+	lookupGeneration = getStoragesGeneration ();
+}
+#endif
+
+Storage* WebServer::findStorage (const char* pagename) {
+	Storage* ret = nullptr;
+	boolean probe = true;
+
+#ifdef LOOKUP_CACHE_SIZE
+	if (getStoragesGeneration () != lookupGeneration) {
+		DPRINTLN (F("Storage contents changed, invalidating lookup cache"));
+		invalidateLookupCache ();
+	}
+
+	uint32_t hash = fnv1a (FNV_OFFSET_BASIS, pagename, strlen (pagename));
+	LookupCacheEntry& entry = lookupCache[hash % LOOKUP_CACHE_SIZE];
+	if (entry.used && entry.hash == hash) {
+		if (!entry.storage) {
+			DPRINTLN (F("Page is known not to exist"));
+			probe = false;
+		} else if (entry.storage -> exists (pagename)) {
+			DPRINTLN (F("Page found on cached storage"));
+			ret = entry.storage;
+			probe = false;
+		}
+
+		// Otherwise the page has moved, look for it again
+	}
+#endif
+
+	byte i = 0;
+	for (Storage* s = storages; probe && s; s = s -> nextStorage, ++i) {
+		if (s -> exists (pagename)) {
+			DPRINT (F("Page found on storage "));
+			DPRINTLN (i);
+			ret = s;
+			probe = false;
+		}
+	}
+
+#ifdef LOOKUP_CACHE_SIZE
+	// Pages that are not found might show up later on some storages
+	if (ret || canCacheMisses ()) {
+		entry.hash = hash;
+		entry.storage = ret;
+		entry.used = true;
+	}
+#endif
+
+	return ret;
+}
+
 PGM_P WebServer::getContentType (const char* filename) {
 	const MimeType* mt = NULL;
 
@@ -140,6 +530,15 @@ PGM_P WebServer::getContentType (const char* filename) {
 	return mt ? mt -> getType () : FALLBACK_MIMETYPE;
 }
 
+PGM_P WebServer::getContentTypeById (byte id) {
+	const MimeType *mt = nullptr;
+
+	for (byte i = 0; (mt = reinterpret_cast<const MimeType*> (pgm_read_ptr (&mimeTypes[i]))) && i < id; ++i)
+		;
+
+	return mt ? mt -> getType () : FALLBACK_MIMETYPE;
+}
+
 void WebServer::handleClient (WebClient& client) {
 	unsigned int l = strlen (client.request.url);
 	if (l == 0 || client.request.url[l - 1] == '/') {
@@ -154,62 +553,88 @@ void WebServer::handleClient (WebClient& client) {
 		else
 			client.print (client.request.url);
 		client.print (F(REDIRECT_ROOT_PAGE HEADER_END));
+#if defined (ENABLE_TAGS) && defined (TAGS_JSON_URL)
+	} else if (strcmp_P (client.request.get_basename (), PSTR (TAGS_JSON_URL)) == 0) {
+		sendTagsJson (client);
+#endif
+#ifdef MAX_EVENT_SUBSCRIBERS
+	} else if (handleEventStream (client)) {
+		// Done
+#endif
 	} else {
 		const char *pagename = client.request.get_basename ();
 
-		byte i;
-		for (i = 0; i < nStorage; ++i) {
-			Storage& stor = *storages[i];
+		// Path of the page within its storage
+		const char *path = pagename;
 
-			if (stor.exists (pagename)) {
-				DPRINT (F("Page found on storage "));
-				DPRINTLN (i);
+		Storage* stor = findMount (pagename);
+		if (stor) {
+			// Mounted storages are authoritative for their prefix
+			path += stor -> mountLen;
+			DPRINT (F("Page is under mount point "));
+			DPRINTLN (stor -> mountPoint);
+			if (!stor -> exists (path))
+				stor = nullptr;
+		} else {
+			stor = findStorage (pagename);
+		}
 
-				/* Get the content NOW: pagename is stored in buffer, and the
-				 * PageFunction, if any, might call request.get_parameter()
-				 * which would overwrite the buffer and thus pagename. Not
-				 * pretty, but it works.
-				 */
-				Content& content = stor.get (pagename);
+		if (stor) {
+			/* Get the content NOW: pagename is stored in buffer, and the
+			 * PageFunction, if any, might call request.get_parameter()
+			 * which would overwrite the buffer and thus pagename. Not
+			 * pretty, but it works.
+			 */
+			Content& content = stor -> get (path);
 
 #ifdef ENABLE_PAGE_FUNCTIONS
-				// Look up page function, if available
-				if (associations != nullptr) {
-					const FileFuncAssociation* ass;
+			// Look up page function, if available
+			if (associations != nullptr) {
+				const FileFuncAssociation* ass;
 
-					for (byte i = 0; (ass = reinterpret_cast<const FileFuncAssociation*> (pgm_read_ptr (&associations[i]))); i++) {
-						if (strcmp_P (pagename, ass -> getPath ()) == 0) {
-							DPRINTLN (F("Page has an associated function"));
+				for (byte i = 0; (ass = reinterpret_cast<const FileFuncAssociation*> (pgm_read_ptr (&associations[i]))); i++) {
+					if (strcmp_P (pagename, ass -> getPath ()) == 0) {
+						DPRINTLN (F("Page has an associated function"));
+#if defined (ENABLE_TAGS) && defined (RENDER_CACHE_SLOTS)
+						// It might change what the page shows
+						dropRenderedPage (pagename);
+#endif
+						PageParameterArray *params = ass -> getParameters ();
+						if (params) {
+							void *data = ass -> getParameterData ();
+							PageParamMask found = client.request.bind_parameters (params, data);
+							BoundPageFunction func = ass -> getBoundFunction ();
+							func (client.request, data, found);
+						} else {
 							PageFunction func = ass -> getFunction ();
 							func (client.request);
-							break;
 						}
+						break;
 					}
 				}
+			}
 #endif
 
-				/* content.getFilename() points to the buffer returned by
-				 * client.request.get_basename (), which might get modified if
-				 * the associated function called get_parameter(), thus let's
-				 * restore it so that it keeps pointing to what is should.
-				 *
-				 * I guess this is crap and should be a FIXME...
-				 */
-				client.request.get_basename ();
-
-				sendContent (client, content);
-				stor.release (content);
-				break;
-			}
-		}
+			/* content.getFilename() points to the buffer returned by
+			 * client.request.get_basename (), which might get modified if
+			 * the associated function called get_parameter(), thus let's
+			 * restore it so that it keeps pointing to what is should.
+			 *
+			 * I guess this is crap and should be a FIXME...
+			 */
+			client.request.get_basename ();
 
-		if (i >= nStorage) {
+			sendContent (client, content);
+			stor -> release (content);
+		} else {
 			// Page not found
 			client.print (F(HEADER_START NOT_FOUND_HEADER HEADER_END));
 
-			client.print (F("<html><body><h3>No such page: \""));
-			client.print (pagename);
-			client.print (F("\"</h3></body></html>"));
+			if (client.request.method != HTTPRequestParser::METHOD_HEAD) {
+				client.print (F("<html><body><h3>No such page: \""));
+				client.print (pagename);
+				client.print (F("\"</h3></body></html>"));
+			}
 		}
 	}
 
@@ -225,15 +650,14 @@ boolean WebServer::shallReplace (PGM_P contType) {
 	return strncmp_P (tmp, PSTR("text"), 4) == 0;
 }
 
-PString* WebServer::findSubstitutionTag (const char *tag) const {
+const ReplacementTag* WebServer::findSubstitutionTag (const char *tag, size_t nameLen) const {
 	const ReplacementTag* sub;
-	PString* ret = nullptr;
+	const ReplacementTag* ret = nullptr;
 
-	for (byte i = 0; !ret && (sub = reinterpret_cast<const ReplacementTag*> (pgm_read_ptr (&substitutions[i]))); i++) {
-		if (strcmp_P (tag, sub -> getName ()) == 0) {
-			PString& pb = (sub -> getFunction ()) (sub -> getData ());
-			ret = &pb;
-		}
+	for (byte i = 0; !ret && substitutions && (sub = reinterpret_cast<const ReplacementTag*> (pgm_read_ptr (&substitutions[i]))); i++) {
+		PGM_P name = sub -> getName ();
+		if (strncmp_P (tag, name, nameLen) == 0 && pgm_read_byte (name + nameLen) == '\0')
+			ret = sub;
 	}
 
 	return ret;
@@ -245,33 +669,781 @@ char *WebServer::findSubstitutionTagGetParameter (HTTPRequestParser& request, co
 #endif
 
 // Read the page, perform tag substitutions and send it over
-// FIXME: Handle unterminated tags
 void WebServer::sendContent (WebClient& client, Content& content) {
-	const byte tagChar = static_cast<byte> (TAG_CHAR);	// Make sure this is a byte and not a char
+	PGM_P contType = content.getContentType ();
+	if (!contType)
+		contType = getContentType (content.getFilename ());
+
+#ifdef ENABLE_TAGS
+	/* Pages that undergo tag replacement might change at every request, so
+	 * neither the ETag nor the size of their template are any good for them
+	 */
+	const boolean replace = shallReplace (contType) && content.mayContainTags ();
+#else
+	const boolean replace = false;
+#endif
 
-	PGM_P contType = getContentType (content.getFilename ());
+#if defined (ENABLE_TAGS) && defined (RENDER_CACHE_SLOTS)
+	const CacheablePage* cp = replace ? findCacheablePage (client.request.get_basename ()) : nullptr;
+	if (cp) {
+		// These get an ETag based on what they look like once rendered
+		sendRenderedPage (client, content, contType, cp -> getMaxAge ());
+		return;
+	}
+#endif
+
+#if defined (ENABLE_TAGS) && defined (TAG_PAGE_ETAGS)
+	if (replace && content.seek (0)) {
+		// Find out what the page will look like before sending anything
+		HashPrint hashed;
+		sendTemplate (hashed, client.request, content);
+		sendHashedPage (client, content, contType, hashed.getHash ());
+		return;
+	}
+#endif
+
+	uint32_t etag = replace ? 0 : content.getETag ();
+
+	char etagStr[ETAG_STR_LEN];
+	if (etag != 0) {
+		formatETag (etagStr, etag);
+
+		if (etagMatches (client.request, etagStr)) {
+			// Client has an up-to-date copy already
+			sendNotModified (client, etagStr);
+			return;
+		}
+	}
+
+	/* Range requests can only be honored if we know the size in advance and
+	 * we can seek to the requested position
+	 */
+	const unsigned long size = replace ? Content::UNKNOWN_SIZE : content.getSize ();
+	unsigned long first = 0, last = 0;
+	unsigned long remaining = Content::UNKNOWN_SIZE;
+	boolean partial = false;
+	if (size != Content::UNKNOWN_SIZE && client.request.rangeType != HTTPRequestParser::RANGE_NONE) {
+		if (client.request.rangeType == HTTPRequestParser::RANGE_SUFFIX) {
+			first = client.request.rangeFirst < size ? size - client.request.rangeFirst : 0;
+			last = size - 1;
+		} else {
+			first = client.request.rangeFirst;
+			last = client.request.rangeLast < size ? client.request.rangeLast : size - 1;
+		}
+
+		if (first >= size) {
+			DPRINTLN (F("Requested range is not satisfiable"));
+
+			client.print (F(HEADER_START NOT_SATISFIABLE_HEADER));
+			client.print (size);
+			client.print (F(HEADER_END));
+			return;
+		} else if (content.seek (first)) {
+			DPRINT (F("Sending range "));
+			DPRINT (first);
+			DPRINT ('-');
+			DPRINTLN (last);
+
+			remaining = last - first + 1;
+			partial = true;
+		}
+	}
 
 	// Send headers
-	client.print (F(HEADER_START OK_HEADER CONT_TYPE_HEADER));
+	client.print (F(HEADER_START));
+	if (partial)
+		client.print (F(PARTIAL_HEADER CONT_TYPE_HEADER));
+	else
+		client.print (F(OK_HEADER CONT_TYPE_HEADER));
 	client.print (PSTR_TO_F (contType));
+	if (size != Content::UNKNOWN_SIZE)
+		client.print (F("\r\n" ACCEPT_RANGES_HEADER));
+	if (partial) {
+		client.print (F("\r\n" CONT_RANGE_HEADER));
+		client.print (first);
+		client.print ('-');
+		client.print (last);
+		client.print ('/');
+		client.print (size);
+	}
+	if (etag != 0) {
+		client.print (F("\r\n" ETAG_HEADER));
+		client.print (etagStr);
+	}
 	client.print (F(HEADER_END));
 
+	if (client.request.method == HTTPRequestParser::METHOD_HEAD) {
+		// Headers are all we need to send
+		return;
+	}
+
+	if (!replace && content.generate (client, client.request)) {
+		// Nothing else to do
+		DPRINTLN (F("Content was generated"));
+	} else if (!replace) {
+		// Nothing to look for in the content, so just pass it over
+		sendRaw (client, content, remaining);
+	}
 #ifdef ENABLE_TAGS
-	char tag[MAX_TAG_LEN];
-	int8_t tagLen = -1;			// If >= 0 we are inside a tag
+	else {		// We only want to do replacements on "text" MIME Types
+		sendTemplate (client, client.request, content);
+	}
 #endif
-	while (content.available ()) {
-		byte c = content.getNextByte ();
+}
+
+void WebServer::sendRaw (Print& out, Content& content, unsigned long len) {
+	// Send straight from memory if possible...
+	const byte *span;
+	size_t n;
+	while (len > 0 && (n = content.readSpan (span, len)) > 0) {
+		out.write (span, n);
+		len -= n;
+	}
+
+	// ... Otherwise pass it over in chunks
+	byte chunk[SEND_CHUNK_SIZE];
+	while (len > 0) {
+		n = content.read (chunk, len < SEND_CHUNK_SIZE ? len : SEND_CHUNK_SIZE);
+		if (n == 0)
+			break;
+
+		out.write (chunk, n);
+		len -= n;
+	}
+}
 
 #ifdef ENABLE_TAGS
-		if (shallReplace (contType)) {		// We only want to do replacements on "text" MIME Types
+boolean WebServer::replaceTag (Print& out, HTTPRequestParser& request, const char* tag, const char* defaultArg) {
+	DPRINT (F("Processing replacement tag: \""));
+	DPRINT (tag);
+	DPRINTLN (F("\""));
+
+	boolean found = false;
+	if (strncmp_P (tag, PSTR ("GETP_"), 5) == 0) {
+#ifdef RENDER_CACHE_SLOTS
+		renderUsedRequest = true;
+#endif
+		char* rep = findSubstitutionTagGetParameter (request, tag + 5);
+		if (rep) {
+			DPRINT (F("Replacement is: \""));
+			DPRINT (rep);
+			DPRINTLN (F("\""));
+
+			out.print (rep);
+			found = true;
+		}
+	} else {
+		// Split the argument, if any, from the name
+		const char *arg = strchr (tag, TAG_ARG_CHAR);
+		const ReplacementTag* sub = findSubstitutionTag (tag, arg ? arg - tag : strlen (tag));
+		if (sub) {
+			TagArgFn argFn = sub -> getArgFunction ();
+			TagStreamFn streamFn = sub -> getStreamFunction ();
+			const char *argStr = arg ? arg + 1 : defaultArg;
+			const CachedTag* ct = arg || (argFn && defaultArg) ? nullptr : findCachedTag (sub);
+			if (ct) {
+				DPRINT (F("Cached replacement is: \""));
+				DPRINT (ct -> getValue ());
+				DPRINTLN (F("\""));
+
+				out.print (ct -> getValue ());
+				found = true;
+			} else if (argFn) {
+				if (!argStr)
+					argStr = "";
+
+				DPRINT (F("Replacement is streamed, argument is: \""));
+				DPRINT (argStr);
+				DPRINTLN (F("\""));
+
+				argFn (out, argStr, sub -> getData ());
+				found = true;
+			} else if (streamFn && !arg) {
+				DPRINTLN (F("Replacement is streamed"));
+				streamFn (out, sub -> getData ());
+				found = true;
+			} else if (sub -> getVarType () != TAGVAR_NONE && !arg) {
+				DPRINTLN (F("Replacement is a variable"));
+				printTagVariable (out, sub);
+				found = true;
+			} else if (!arg) {
+				PString& pstr = (sub -> getFunction ()) (sub -> getData ());
+
+				DPRINT (F("Replacement is: \""));
+				DPRINT (pstr);
+				DPRINTLN (F("\""));
+
+				out.print (pstr);
+				pstr.begin ();		// Reset for next usage
+				found = true;
+			}
+
+			// Otherwise the tag does not take arguments, so it's not a match
+		}
+	}
+
+	return found;
+}
+
+#ifdef TAGS_JSON_URL
+boolean WebServer::isKnownTag (const char* tag) const {
+	const char *arg = strchr (tag, TAG_ARG_CHAR);
+	const ReplacementTag* sub = findSubstitutionTag (tag, arg ? arg - tag : strlen (tag));
+
+	// Tags only take an argument if they have a TagArgFn
+	return sub && (!arg || sub -> getArgFunction ());
+}
+
+void WebServer::sendTagJson (WebClient& client, const char* name, size_t len, boolean first) {
+	JsonEscapePrint escaped (client);
+
+	if (!first)
+		client.write (',');
+	client.write ('"');
+	escaped.write (name, len);
+	client.print (F("\":"));
+
+	// GETP_ tags make no sense here, the client knows what it asked for
+	char tag[MAX_TAG_LEN];
+	boolean found = false;
+	if (len < MAX_TAG_LEN && strncmp_P (name, PSTR ("GETP_"), 5) != 0) {
+		memcpy (tag, name, len);
+		tag[len] = '\0';
+		found = isKnownTag (tag);
+	}
+
+	if (found) {
+		client.write ('"');
+		replaceTag (escaped, client.request, tag, nullptr);
+		client.write ('"');
+	} else {
+		client.print (F("null"));
+	}
+}
+
+void WebServer::sendTagsJson (WebClient& client) {
+	DPRINTLN (F("Sending tag values"));
+
+	client.print (F(HEADER_START OK_HEADER CONT_TYPE_HEADER JSON_CONT_TYPE HEADER_END));
+
+	if (client.request.method != HTTPRequestParser::METHOD_HEAD) {
+		client.write ('{');
+
+		/* Names are separated by commas. The list is taken straight from the
+		 * URL, since get_parameter() would truncate it to BUF_LEN, and
+		 * decoded as a whole, as the commas might be encoded too.
+		 */
+		const char *param = nullptr;
+		for (const char *p = strchr (client.request.url, '?'); !param && p; p = strchr (p + 1, '&')) {
+			if (p[1] == 't' && p[2] == '=')
+				param = p + 3;
+		}
+
+		char list[MAX_URL_LEN];
+		list[0] = '\0';
+		if (param)
+			HTTPRequestParser::decode (list, sizeof (list), param, strcspn (param, "&"));
+
+		if (list[0] != '\0') {
+			boolean first = true;
+			for (const char *name = list; *name != '\0'; ) {
+				const size_t len = strcspn (name, ",");
+				if (len > 0) {
+					sendTagJson (client, name, len, first);
+					first = false;
+				}
+
+				name += len;
+				if (*name == ',')
+					++name;
+			}
+		} else {
+			const ReplacementTag* sub;
+			for (byte i = 0; substitutions && (sub = reinterpret_cast<const ReplacementTag*> (pgm_read_ptr (&substitutions[i]))); ++i) {
+				char name[MAX_TAG_LEN];
+				strncpy_P (name, sub -> getName (), MAX_TAG_LEN);
+				name[MAX_TAG_LEN - 1] = '\0';
+				sendTagJson (client, name, strlen (name), i == 0);
+			}
+		}
+
+		client.write ('}');
+	}
+}
+#endif
+
+#ifdef ENABLE_TAG_BLOCKS
+// True if the name of tag (i.e.: what comes before TAG_ARG_CHAR) is kw
+static boolean isTagName (const char* tag, PGM_P kw) {
+	const size_t len = strlen_P (kw);
+	return strncmp_P (tag, kw, len) == 0 && (tag[len] == '\0' || tag[len] == TAG_ARG_CHAR);
+}
+
+long WebServer::evaluateTag (HTTPRequestParser& request, const char* expr, const char* defaultArg, boolean& truth) {
+	long ret = 0;
+	truth = false;
+
+	if (isdigit (expr[0])) {
+		ret = atol (expr);
+		truth = ret != 0;
+	} else {
+		char buf[CACHED_TAG_LEN];
+		PString pstr (buf, sizeof (buf));
+		if (replaceTag (pstr, request, expr, defaultArg)) {
+			ret = atol (buf);
+			truth = buf[0] != '\0' && strcmp_P (buf, PSTR ("0")) != 0;
+		}
+	}
+
+	return ret;
+}
+
+boolean WebServer::isSkipping () const {
+	return blocks.skipDepth > 0;
+}
+#else
+boolean WebServer::isSkipping () const {
+	return false;
+}
+#endif
+
+boolean WebServer::processTag (Print& out, HTTPRequestParser& request, Content& content, const char* tag, unsigned long& pos) {
+	boolean moved = false;
+	boolean found = true;
+
+#ifdef ENABLE_TAG_BLOCKS
+	const char *arg = strchr (tag, TAG_ARG_CHAR);
+
+	// Within a repeat, tags taking an argument get the iteration if they have none
+	TagBlocks::Repeat* repeat = blocks.nRepeats > 0 ? &blocks.repeats[blocks.nRepeats - 1] : nullptr;
+	char indexStr[6];
+	if (repeat) {
+		PString pstr (indexStr, sizeof (indexStr));
+		pstr.print (repeat -> index);
+	}
+	const char *defaultArg = repeat ? indexStr : nullptr;
+
+	if (blocks.skipDepth > 0) {
+		// Only keep track of nesting, so that we know where to resume
+		if (isTagName (tag, PSTR ("REPEAT")) || isTagName (tag, PSTR ("IF")))
+			++blocks.skipDepth;
+		else if (isTagName (tag, PSTR ("END")) || isTagName (tag, PSTR ("ENDIF")))
+			--blocks.skipDepth;
+	} else if (isTagName (tag, PSTR ("REPEAT")) && arg) {
+		boolean truth;
+		long count = evaluateTag (request, arg + 1, defaultArg, truth);
+		if (count <= 0) {
+			blocks.skipDepth = 1;
+		} else if (blocks.nRepeats >= MAX_TAG_BLOCK_DEPTH) {
+			DPRINTLN (F("WARNING: Too many nested repeats"));
+			blocks.skipDepth = 1;
+		} else {
+			DPRINT (F("Repeating block "));
+			DPRINT (count);
+			DPRINTLN (F(" times"));
+
+			TagBlocks::Repeat& r = blocks.repeats[blocks.nRepeats++];
+			r.bodyStart = pos;
+			r.count = count < 0xFFFF ? count : 0xFFFF;
+			r.index = 0;
+		}
+	} else if (isTagName (tag, PSTR ("END")) && !arg && repeat) {
+		if (++repeat -> index < repeat -> count && content.seek (repeat -> bodyStart)) {
+			pos = repeat -> bodyStart;
+			moved = true;
+		} else {
+			--blocks.nRepeats;
+		}
+	} else if (isTagName (tag, PSTR ("IF")) && arg) {
+		boolean truth;
+		evaluateTag (request, arg + 1, defaultArg, truth);
+		if (!truth)
+			blocks.skipDepth = 1;
+	} else if (isTagName (tag, PSTR ("ENDIF")) && !arg) {
+		// End of an #IF# that held, nothing to do
+	} else if (isTagName (tag, PSTR ("INDEX")) && !arg && repeat) {
+		out.print (repeat -> index);
+	} else {
+		found = replaceTag (out, request, tag, defaultArg);
+	}
+#else
+	found = replaceTag (out, request, tag, nullptr);
+	(void) content;
+	(void) pos;
+#endif
+
+	if (!found) {
+		// Tag not found, emit it
+		DPRINTLN (F("Tag not found"));
+
+		const byte tagChar = static_cast<byte> (TAG_CHAR);
+		out.write (tagChar);
+		out.print (tag);
+		out.write (tagChar);
+	}
+
+	return moved;
+}
+
+#ifdef TAG_INDEX_SLOTS
+/* Returns the slot with the index of the content if there is one (setting hit),
+ * otherwise a slot where it can be built, if the content can be indexed at all
+ */
+TagIndexSlot* WebServer::findTagIndex (Content& content, boolean& hit) {
+	TagIndexSlot* ret = nullptr;
+	hit = false;
+
+	const unsigned long size = content.getSize ();
+	const uint32_t etag = content.getETag ();
+	const char *filename = content.getFilename ();
+	if (size != Content::UNKNOWN_SIZE && etag != 0 && filename) {
+		const uint32_t hash = fnv1a (FNV_OFFSET_BASIS, filename, strlen (filename));
+
+		TagIndexSlot* lru = &tagIndex[0];
+		for (byte i = 0; !hit && i < TAG_INDEX_SLOTS; ++i) {
+			TagIndexSlot& slot = tagIndex[i];
+			if (slot.lastUse != 0 && slot.nameHash == hash) {
+				if (slot.size == size && slot.etag == etag) {
+					ret = &slot;
+					hit = true;
+				} else {
+					// Page has changed, rebuild its index here
+					lru = &slot;
+					break;
+				}
+			} else if (slot.lastUse < lru -> lastUse) {
+				lru = &slot;
+			}
+		}
+
+		if (hit) {
+			ret -> lastUse = ++tagIndexCounter;
+		} else {
+			ret = lru;
+			ret -> nameHash = hash;
+			ret -> etag = etag;
+			ret -> size = size;
+			ret -> lastUse = 0;		// Until the index is complete
+			ret -> nTags = 0;
+		}
+	}
+
+	return ret;
+}
+
+void WebServer::sendIndexedTemplate (Print& out, HTTPRequestParser& request, Content& content, const TagIndexSlot& slot) {
+	char tag[MAX_TAG_LEN];
+	unsigned long pos = 0;
+
+	byte i = 0;
+	while (i < slot.nTags) {
+		// Text up to the tag...
+		const unsigned long len = slot.offsets[i] - pos;
+		if (!isSkipping ())
+			sendRaw (out, content, len);
+		else if (!content.seek (slot.offsets[i]))
+			skipRaw (content, len);
+
+		// ... Then the tag itself, without the delimiters
+		content.getNextByte ();
+		byte tagLen = 0;
+		for (byte j = 2; j < slot.lengths[i]; ++j) {
+			byte c = content.getNextByte ();
+			if (tagLen < MAX_TAG_LEN - 1)
+				tag[tagLen++] = c;
+		}
+		tag[tagLen] = '\0';
+		content.getNextByte ();
+
+		pos = slot.offsets[i] + slot.lengths[i];
+		if (processTag (out, request, content, tag, pos)) {
+			// Went back to the start of a repeat, find the first tag after it
+			for (i = 0; i < slot.nTags && slot.offsets[i] < pos; ++i)
+				;
+		} else {
+			++i;
+		}
+	}
+
+	// Whatever follows the last tag
+	if (!isSkipping ())
+		sendRaw (out, content, Content::UNKNOWN_SIZE);
+}
+#endif
+
+void WebServer::skipRaw (Content& content, unsigned long len) {
+	byte chunk[SEND_CHUNK_SIZE];
+	while (len > 0) {
+		size_t n = content.read (chunk, len < SEND_CHUNK_SIZE ? len : SEND_CHUNK_SIZE);
+		if (n == 0)
+			break;
+
+		len -= n;
+	}
+}
+
+#if defined (ENABLE_TAGS) && defined (TAG_PAGE_ETAGS)
+void WebServer::sendHashedPage (WebClient& client, Content& content, PGM_P contType, uint32_t hash) {
+	char etagStr[ETAG_STR_LEN];
+	formatETag (etagStr, hash);
+
+	if (etagMatches (client.request, etagStr)) {
+		sendNotModified (client, etagStr);
+	} else {
+		sendPageHeaders (client, contType, etagStr);
+		if (client.request.method != HTTPRequestParser::METHOD_HEAD && content.seek (0))
+			sendTemplate (client, client.request, content);
+	}
+}
+#endif
+
+#ifdef RENDER_CACHE_SLOTS
+/* Keeps whatever is printed to it in a buffer, hashing it along the way. If
+ * it does not fit and the page cannot be rendered again, the headers of the
+ * page are sent without an ETag, followed by what was kept so far and anything
+ * printed afterwards. Otherwise it only keeps hashing.
+ */
+class SpillPrint: public Print {
+private:
+	Print& out;
+	byte *buf;
+	size_t size;
+	size_t len;
+	uint32_t hash;
+	PGM_P contType;
+	boolean sendBody;
+	boolean hashOnly;		// Once the page turns out to be too long
+	boolean spilled;
+
+public:
+	SpillPrint (Print& _out, byte* _buf, size_t _size, PGM_P _contType, boolean _sendBody, boolean _canRender):
+		out (_out), buf (_buf), size (_size), len (0), hash (FNV_OFFSET_BASIS),
+		contType (_contType), sendBody (_sendBody), hashOnly (_canRender), spilled (false) {
+	}
+
+	size_t write (uint8_t c) override {
+		return write (&c, 1);
+	}
+
+	size_t write (const uint8_t *data, size_t n) override {
+		hash = fnv1a (hash, data, n);
+
+		if (!spilled) {
+			if (len + n <= size) {
+				memcpy (buf + len, data, n);
+				len += n;
+			} else {
+				spilled = true;
+				if (!hashOnly) {
+					DPRINTLN (F("Page is too long to be kept, sending it without ETag"));
+					sendPageHeaders (out, contType, nullptr);
+					if (sendBody)
+						out.write (buf, len);
+				}
+			}
+		}
+
+		if (spilled && !hashOnly && sendBody)
+			out.write (data, n);
+
+		return n;
+	}
+
+	using Print::write;
+
+	size_t getLength () const {
+		return len;
+	}
+
+	uint32_t getHash () const {
+		return hash != 0 ? hash : 1;		// 0 means "no ETag"
+	}
+
+	boolean hasSpilled () const {
+		return spilled;
+	}
+
+	// True if nothing was sent, i.e. the page has to be rendered again
+	boolean hasOnlyHashed () const {
+		return spilled && hashOnly;
+	}
+};
+
+void WebServer::cacheRenderedPages (CacheablePageArray* _pages) {
+	cacheablePages = _pages;
+
+	for (byte i = 0; i < RENDER_CACHE_SLOTS; ++i)
+		renderCache[i].valid = false;
+}
+
+const CacheablePage* WebServer::findCacheablePage (const char* pagename) const {
+	const CacheablePage* ret = nullptr;
+
+	const CacheablePage* cp;
+	for (byte i = 0; !ret && cacheablePages && (cp = reinterpret_cast<const CacheablePage*> (pgm_read_ptr (&cacheablePages[i]))); ++i) {
+		if (strcmp_P (pagename, cp -> getPath ()) == 0)
+			ret = cp;
+	}
+
+	return ret;
+}
+
+/* Returns the slot with the page if it is there and still fresh (setting hit),
+ * otherwise a slot where it can be stored
+ */
+RenderCacheSlot* WebServer::findRenderedPage (const char* pagename, uint32_t etag, unsigned long maxAge, boolean& hit) {
+	const uint32_t hash = fnv1a (FNV_OFFSET_BASIS, pagename, strlen (pagename));
+	const unsigned long now = millis ();
+
+	RenderCacheSlot* ret = nullptr;
+	RenderCacheSlot* oldest = &renderCache[0];
+	for (byte i = 0; !ret && i < RENDER_CACHE_SLOTS; ++i) {
+		RenderCacheSlot& slot = renderCache[i];
+		if (slot.valid && slot.nameHash == hash) {
+			ret = &slot;
+		} else if (oldest -> valid && (!slot.valid || now - slot.rendered > now - oldest -> rendered)) {
+			oldest = &slot;
+		}
+	}
+
+	hit = ret && ret -> etag == etag && now - ret -> rendered < maxAge;
+	if (!hit) {
+		if (!ret)
+			ret = oldest;
+		ret -> nameHash = hash;
+		ret -> etag = etag;
+		ret -> valid = false;		// Until the page has been rendered
+	}
+
+	return ret;
+}
+
+void WebServer::dropRenderedPage (const char* pagename) {
+	const uint32_t hash = fnv1a (FNV_OFFSET_BASIS, pagename, strlen (pagename));
+	for (byte i = 0; i < RENDER_CACHE_SLOTS; ++i) {
+		if (renderCache[i].nameHash == hash)
+			renderCache[i].valid = false;
+	}
+}
+
+void WebServer::sendRenderedPage (WebClient& client, Content& content, PGM_P contType, unsigned long maxAge) {
+	const boolean head = client.request.method == HTTPRequestParser::METHOD_HEAD;
+
+	boolean hit;
+	RenderCacheSlot* slot = findRenderedPage (client.request.get_basename (), content.getETag (), maxAge, hit);
+	if (hit) {
+		DPRINTLN (F("Using rendered page from cache"));
+	} else {
+#ifdef TAG_PAGE_ETAGS
+		const boolean canRender = content.seek (0);
+#else
+		const boolean canRender = false;
+#endif
+		SpillPrint spill (client, slot -> body, RENDER_CACHE_LEN, contType, !head, canRender);
+		renderUsedRequest = false;
+		sendTemplate (spill, client.request, content);
+
+		if (spill.hasSpilled ()) {
+#ifdef TAG_PAGE_ETAGS
+			if (spill.hasOnlyHashed ()) {
+				DPRINTLN (F("Page is too long to be kept, rendering it again"));
+				sendHashedPage (client, content, contType, spill.getHash ());
+			}
+#endif
+			// Otherwise already sent
+			slot = nullptr;
+		} else {
+			slot -> len = spill.getLength ();
+			slot -> bodyETag = spill.getHash ();
+			if (!renderUsedRequest) {
+				DPRINTLN (F("Rendered page was cached"));
+				slot -> rendered = millis ();
+				slot -> valid = true;
+			}
+		}
+	}
+
+	if (slot) {
+		char etagStr[ETAG_STR_LEN];
+		formatETag (etagStr, slot -> bodyETag);
+
+		if (etagMatches (client.request, etagStr)) {
+			sendNotModified (client, etagStr);
+		} else {
+			sendPageHeaders (client, contType, etagStr);
+			if (!head)
+				client.write (slot -> body, slot -> len);
+		}
+	}
+}
+#endif
+
+/* Reads the next chunk of content, straight from memory if possible, otherwise
+ * into chunk. Returns its length, 0 at the end of the content.
+ */
+static size_t readChunk (Content& content, byte* chunk, const byte*& data) {
+	size_t n = content.readSpan (data, SEND_CHUNK_SIZE);
+	if (n == 0) {
+		n = content.read (chunk, SEND_CHUNK_SIZE);
+		data = chunk;
+	}
+
+	return n;
+}
+
+void WebServer::sendTemplate (Print& out, HTTPRequestParser& request, Content& content) {
+	const byte tagChar = static_cast<byte> (TAG_CHAR);	// Make sure this is a byte and not a char
+
+#ifdef ENABLE_TAG_BLOCKS
+	blocks.nRepeats = 0;
+	blocks.skipDepth = 0;
+#endif
+
+#ifdef TAG_INDEX_SLOTS
+	boolean hit;
+	TagIndexSlot* slot = findTagIndex (content, hit);
+	if (hit && slot -> nTags != TagIndexSlot::TOO_MANY_TAGS) {
+		DPRINTLN (F("Using tag index"));
+		sendIndexedTemplate (out, request, content, *slot);
+		return;
+	}
+
+	// Offset of the start of the current tag. Tags before indexed were already
+	// seen, i.e.: they are in a repeat.
+	unsigned long tagStart = 0, indexed = 0;
+#endif
+
+	// Offset of the first byte of the current chunk
+	unsigned long pos = 0;
+
+	char tag[MAX_TAG_LEN];
+	int8_t tagLen = -1;			// If >= 0 we are inside a tag
+
+	byte chunk[SEND_CHUNK_SIZE];
+	const byte *data;
+	size_t n;
+	while ((n = readChunk (content, chunk, data)) > 0) {
+		boolean moved = false;
+		size_t i = 0;
+		while (i < n && !moved) {
 			if (tagLen >= 0) {
-				// A tag is in progress
-				if (c == tagChar) {
+				// A tag is in progress, look for its end
+				const byte *end = reinterpret_cast<const byte *> (memchr (data + i, tagChar, n - i));
+				const size_t len = (end ? end - data : n) - i;
+				if (tagLen < MAX_TAG_LEN - 1) {
+					const size_t room = MAX_TAG_LEN - 1 - tagLen;
+					const size_t copied = len < room ? len : room;
+					memcpy (tag + tagLen, data + i, copied);
+					tag[tagLen + copied] = '\0';
+				}
+
+				// If the tag is too long, keep counting for debugging purposes
+				tagLen = tagLen + len < 127 ? tagLen + len : 127;
+				i += len;
+
+				if (end) {
 					// End of tag
-					DPRINT (F("Processing replacement tag: \""));
-					DPRINT (tag);
-					DPRINTLN (F("\""));
+					++i;
 
 					if (tagLen >= MAX_TAG_LEN - 1) {
 						DPRINT (F("WARNING: Tag was truncated (Max length is "));
@@ -279,66 +1451,82 @@ void WebServer::sendContent (WebClient& client, Content& content) {
 						DPRINTLN ((byte) ')');
 					}
 
-					boolean found = false;
-					if (strncmp_P (tag, PSTR ("GETP_"), 5) == 0) {
-						char* rep = findSubstitutionTagGetParameter (client.request, tag + 5);
-						if (rep) {
-							DPRINT (F("Replacement is: \""));
-							DPRINT (rep);
-							DPRINTLN (F("\""));
+					unsigned long tagEnd = pos + i;
 
-							client.print (rep);
-							found = true;
-						}
-					} else {
-						PString* pstr = findSubstitutionTag (tag);
-						if (pstr) {
-							DPRINT (F("Replacement is: \""));
-							DPRINT (*pstr);
-							DPRINTLN (F("\""));
-
-							client.print (*pstr);
-							pstr -> begin ();		// Reset for next usage
-							found = true;
+#ifdef TAG_INDEX_SLOTS
+					if (slot && slot -> nTags != TagIndexSlot::TOO_MANY_TAGS && tagStart >= indexed) {
+						unsigned long tagSize = tagEnd - tagStart;
+						if (slot -> nTags < TAG_INDEX_MAX_TAGS && tagSize <= 0xFF) {
+							slot -> offsets[slot -> nTags] = tagStart;
+							slot -> lengths[slot -> nTags] = tagSize;
+							++slot -> nTags;
+						} else {
+							slot -> nTags = TagIndexSlot::TOO_MANY_TAGS;
 						}
 					}
 
-					if (!found) {
-						// Tag not found, emit it
-						DPRINTLN (F("Tag not found"));
-
-						client.write (tagChar);
-						client.print (tag);
-						client.write (tagChar);
-					}
+					if (tagEnd > indexed)
+						indexed = tagEnd;
+#endif
 
 					// Prepare for next tag
 					tagLen = -1;
-				} else if (tagLen < MAX_TAG_LEN - 1) {
-					// Tag continues
-					tag[tagLen++] = c;
-					tag[tagLen] = '\0';
-				} else {
-					// Tag too long, just count for debugging purposes
-					++tagLen;
+
+					if (processTag (out, request, content, tag, tagEnd)) {
+						// Went back, the rest of the chunk is no longer of use
+						pos = tagEnd;
+						moved = true;
+					}
 				}
 			} else {
-				if (c == tagChar) {
+				// Send everything up to the next (possible) tag in one go
+				const byte *start = reinterpret_cast<const byte *> (memchr (data + i, tagChar, n - i));
+				const size_t len = (start ? start - data : n) - i;
+				if (len > 0 && !isSkipping ())
+					out.write (data + i, len);
+				i += len;
+
+				if (start) {
 					// (Possible) New tag
 					tag[0] = '\0';
 					tagLen = 0;
-				} else {
-					client.write (c);		// c is a raw byte
+#ifdef TAG_INDEX_SLOTS
+					tagStart = pos + i;
+#endif
+					++i;
 				}
 			}
-		} else {
-			client.write (c);
 		}
-#else
-		client.write (c);
+
+		if (!moved)
+			pos += n;
+	}
+
+	if (tagLen >= 0) {
+		// Unterminated tag, it was just text after all
+		if (!isSkipping ()) {
+			out.write (tagChar);
+			out.print (tag);
+		}
+
+#ifdef TAG_INDEX_SLOTS
+		// We could not send all of it, so sending the page in bulk would differ
+		if (slot && tagLen >= MAX_TAG_LEN - 1)
+			slot -> nTags = TagIndexSlot::TOO_MANY_TAGS;
 #endif
 	}
+
+#ifdef TAG_INDEX_SLOTS
+	// The index is complete, make the slot usable. Pages that cannot be indexed
+	// are also remembered, so that we don't try again every time.
+	if (slot) {
+		DPRINT (F("Tags indexed: "));
+		DPRINTLN (slot -> nTags);
+		slot -> lastUse = ++tagIndexCounter;
+	}
+#endif
 }
+#endif
 
 boolean WebServer::loop () {
 	WebClient *client = netint -> processPacket ();
@@ -350,6 +1538,17 @@ boolean WebServer::loop () {
 
 		handleClient (*client);
 	}
+	else {
+#ifdef ENABLE_TAGS
+		// Nothing else to do, so take the chance to update cached tags
+		refreshCachedTags ();
+#endif
+
+#ifdef MAX_EVENT_SUBSCRIBERS
+		// ... and to free the slots of subscribers that went away
+		pruneEventStreams ();
+#endif
+	}
 
 	return client != NULL;
 }
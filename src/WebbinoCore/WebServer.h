@@ -30,15 +30,43 @@
 
 class WebClient;
 class Content;
+class EventStream;
 
 #ifdef ENABLE_TAGS
 
 typedef PString& (*TagEvaluateFn) (void* data);
 
+/* Tags whose replacement is long, or not known in advance, can use a function
+ * of this kind instead, which will write it directly to the client
+ */
+typedef void (*TagStreamFn) (Print& out, void* data);
+
+/* Tags can also take an argument, i.e.: #RELAY:3#, so that a single function
+ * can handle many similar tags. arg is an empty string if the tag was used
+ * without one.
+ */
+typedef void (*TagArgFn) (Print& out, const char* arg, void* data);
+
+/* Tags can also be bound to a variable, which will be formatted without the
+ * need for any function. These are the types it can have.
+ */
+enum TagVarType {
+	TAGVAR_NONE = 0,
+	TAGVAR_BOOL,		// boolean, replaced with "1" or "0"
+	TAGVAR_UINT16,		// uint16_t
+	TAGVAR_INT32,		// int32_t
+	TAGVAR_FIXED,		// int32_t, with some of its digits after the decimal point
+	TAGVAR_STRING		// const char*, must not be NULL
+};
+
 struct ReplacementTag {
 	PGM_P name;				// Max length: MAX_TAG_LEN
 	TagEvaluateFn function;
 	void *data;
+	TagStreamFn streamFunction;		// Used instead of function if set
+	TagArgFn argFunction;			// Used instead of both the above if set
+	byte varType;					// A TagVarType, data points to the variable
+	byte varDecimals;				// For TAGVAR_FIXED
 
 	// Methods that (try to) hide the complexity of accessing PROGMEM data
 	PGM_P getName () const {
@@ -52,6 +80,22 @@ struct ReplacementTag {
 	void *getData () const {
 		return reinterpret_cast<void *> (const_cast<void *> (pgm_read_ptr (&(this -> data))));
 	}
+
+	TagStreamFn getStreamFunction () const {
+		return reinterpret_cast<TagStreamFn> (pgm_read_ptr (&(this -> streamFunction)));
+	}
+
+	TagArgFn getArgFunction () const {
+		return reinterpret_cast<TagArgFn> (pgm_read_ptr (&(this -> argFunction)));
+	}
+
+	byte getVarType () const {
+		return pgm_read_byte (&(this -> varType));
+	}
+
+	byte getVarDecimals () const {
+		return pgm_read_byte (&(this -> varDecimals));
+	}
 };
 
 /* Macros that simplify things
@@ -64,7 +108,7 @@ struct ReplacementTag {
 
 #define RepTagWithArg(var, tag, fn, arg) \
                 const char REPTAG_STR_VAR(tag)[] PROGMEM = REPTAG_STR(tag); \
-                const ReplacementTag var PROGMEM = {REPTAG_STR_VAR(tag), fn, reinterpret_cast<void *> (arg)};
+                const ReplacementTag var PROGMEM = {REPTAG_STR_VAR(tag), fn, reinterpret_cast<void *> (arg), nullptr, nullptr, TAGVAR_NONE, 0};
 
 #define RepTagNoArg(var, tag, fn) RepTagWithArg(var, tag, fn, NULL)
 
@@ -72,8 +116,172 @@ struct ReplacementTag {
 #define GET_MACRO(_1, _2, _3, _4, NAME, ...) NAME
 #define EasyReplacementTag(...) GET_MACRO (__VA_ARGS__, RepTagWithArg, RepTagNoArg) (__VA_ARGS__)
 
+/* Same as above, for tags with a TagStreamFn, i.e.:
+ * EasyStreamTag (tagList, LIST, printList);
+ */
+#define StreamTagWithArg(var, tag, fn, arg) \
+                const char REPTAG_STR_VAR(tag)[] PROGMEM = REPTAG_STR(tag); \
+                const ReplacementTag var PROGMEM = {REPTAG_STR_VAR(tag), nullptr, reinterpret_cast<void *> (arg), fn, nullptr, TAGVAR_NONE, 0};
+
+#define StreamTagNoArg(var, tag, fn) StreamTagWithArg(var, tag, fn, NULL)
+
+#define EasyStreamTag(...) GET_MACRO (__VA_ARGS__, StreamTagWithArg, StreamTagNoArg) (__VA_ARGS__)
+
+/* And for tags with a TagArgFn, i.e.:
+ * EasyArgTag (tagRelay, RELAY, printRelayState);
+ * Note that the "data" argument of the macro is the one passed to the function
+ * as data, not the one that comes with the tag.
+ */
+#define ArgTagWithArg(var, tag, fn, arg) \
+                const char REPTAG_STR_VAR(tag)[] PROGMEM = REPTAG_STR(tag); \
+                const ReplacementTag var PROGMEM = {REPTAG_STR_VAR(tag), nullptr, reinterpret_cast<void *> (arg), nullptr, fn, TAGVAR_NONE, 0};
+
+#define ArgTagNoArg(var, tag, fn) ArgTagWithArg(var, tag, fn, NULL)
+
+#define EasyArgTag(...) GET_MACRO (__VA_ARGS__, ArgTagWithArg, ArgTagNoArg) (__VA_ARGS__)
+
+/* And for tags bound to a variable, i.e.:
+ * uint16_t rpm;
+ * EasyUInt16Tag (tagRpm, RPM, rpm);
+ * The variable is checked to be of the right type.
+ */
+#define VarTag(var, tag, type, decimals, ptr) \
+                const char REPTAG_STR_VAR(tag)[] PROGMEM = REPTAG_STR(tag); \
+                const ReplacementTag var PROGMEM = {REPTAG_STR_VAR(tag), nullptr, static_cast<void *> (ptr), nullptr, nullptr, type, decimals};
+
+#define EasyBoolTag(var, tag, variable) VarTag (var, tag, TAGVAR_BOOL, 0, static_cast<boolean *> (&variable))
+#define EasyUInt16Tag(var, tag, variable) VarTag (var, tag, TAGVAR_UINT16, 0, static_cast<uint16_t *> (&variable))
+#define EasyInt32Tag(var, tag, variable) VarTag (var, tag, TAGVAR_INT32, 0, static_cast<int32_t *> (&variable))
+#define EasyStringTag(var, tag, variable) VarTag (var, tag, TAGVAR_STRING, 0, const_cast<const char **> (&variable))
+
+// I.e.: int32_t temp = 2150; EasyFixedTag (tagTemp, TEMP, temp, 2) gives "21.50"
+#define EasyFixedTag(var, tag, variable, decimals) VarTag (var, tag, TAGVAR_FIXED, decimals, static_cast<int32_t *> (&variable))
+
 typedef const ReplacementTag* const EasyReplacementTagArray;
 
+/* Tags whose functions are slow (i.e.: they read a sensor that takes a while
+ * to answer) can have their value cached. Cached tags are refreshed in
+ * WebServer::loop() when there is no client to serve, as soon as they are
+ * older than maxAge milliseconds, so that pages only ever use cached values
+ * and are not slowed down. Usage:
+ *   EasyReplacementTag (tagTemp, TEMPERATURE, evaluate_temperature);
+ *   CachedTag cachedTemp (tagTemp, 5000);
+ *   ...
+ *   webserver.enableReplacementTags (tags);
+ *   webserver.addCachedTag (cachedTemp);
+ *
+ * Values longer than CACHED_TAG_LEN - 1 are truncated.
+ */
+class CachedTag {
+private:
+	friend class WebServer;
+
+	const ReplacementTag* tag;
+	unsigned long maxAge;
+	unsigned long lastRefresh;
+	char value[CACHED_TAG_LEN];
+	CachedTag* next;
+
+public:
+	CachedTag (const ReplacementTag& _tag, unsigned long _maxAge):
+		tag (&_tag), maxAge (_maxAge), lastRefresh (0), next (nullptr) {
+
+		value[0] = '\0';
+	}
+
+	void refresh ();
+
+	const char* getValue () const {
+		return value;
+	}
+};
+
+#ifdef TAG_INDEX_SLOTS
+/* Positions of the tags in a page, so that the text in between can be sent
+ * without looking at it. Pages are identified by the hash of their name, and
+ * their size and ETag must match for the index to be used.
+ */
+struct TagIndexSlot {
+	uint32_t nameHash;
+	uint32_t etag;
+	unsigned long size;
+	unsigned long lastUse;		// 0 means the slot is free
+	byte nTags;
+	uint32_t offsets[TAG_INDEX_MAX_TAGS];	// Of the opening TAG_CHAR
+	byte lengths[TAG_INDEX_MAX_TAGS];		// Including both TAG_CHARs
+
+	// Means the page cannot be indexed, i.e.: it has too many tags
+	static const byte TOO_MANY_TAGS = 0xFF;
+};
+#endif
+
+#ifdef RENDER_CACHE_SLOTS
+/* A page with tags as it was last sent. Pages are identified by the hash of
+ * their URL, and the ETag of their template must match for the slot to be
+ * used. The page is sent with an ETag made from its contents.
+ */
+struct RenderCacheSlot {
+	uint32_t nameHash;
+	uint32_t etag;
+	uint32_t bodyETag;
+	unsigned long rendered;		// millis() when the slot was filled
+	size_t len;
+	boolean valid;
+	byte body[RENDER_CACHE_LEN];
+};
+
+/* A page that can be sent again as it was last rendered, for up to maxAge
+ * milliseconds, without evaluating its tags. Only use this for pages that can
+ * be a bit out of date, and whose tags do not need to run at every request.
+ * Usage:
+ *   RenderCachedPage (cpStatus, "/status.html", 1000);
+ *   CacheablePageArray cachedPages[] PROGMEM = {&cpStatus, NULL};
+ *   ...
+ *   webserver.cacheRenderedPages (cachedPages);
+ */
+struct CacheablePage {
+	PGM_P path;
+	unsigned long maxAge;
+
+	PGM_P getPath () const {
+		return reinterpret_cast<PGM_P> (pgm_read_ptr (&(this -> path)));
+	}
+
+	unsigned long getMaxAge () const {
+		return pgm_read_dword (&(this -> maxAge));
+	}
+};
+
+#define REPTAG_CP_VAR(var) _cp_ ## var
+#define RenderCachedPage(var, path, maxAge) \
+                const char REPTAG_CP_VAR(var)[] PROGMEM = path; \
+const CacheablePage var PROGMEM = {REPTAG_CP_VAR(var), maxAge};
+
+// For pages in flash, where a PROGMEM variable with the filename is available
+#define FlashRenderCachedPage(var, path, maxAge) \
+	const CacheablePage var PROGMEM = {path, maxAge};
+
+typedef const CacheablePage* const CacheablePageArray;
+#endif
+
+#ifdef ENABLE_TAG_BLOCKS
+/* State of the #REPEAT# and #IF# blocks of the page being sent
+ */
+struct TagBlocks {
+	struct Repeat {
+		unsigned long bodyStart;	// Offset of what follows the #REPEAT# tag
+		uint16_t count;
+		uint16_t index;
+	};
+
+	Repeat repeats[MAX_TAG_BLOCK_DEPTH];
+	byte nRepeats;
+
+	// Nesting level of the blocks being skipped, content is only sent if 0
+	byte skipDepth;
+};
+#endif
+
 #endif
 
 /******************************************************************************/
@@ -81,10 +289,19 @@ typedef const ReplacementTag* const EasyReplacementTagArray;
 #ifdef ENABLE_PAGE_FUNCTIONS
 typedef void (*PageFunction) (HTTPRequestParser& request);
 
+/* Page functions that declare their parameters get them already extracted and
+ * converted into their struct, together with the mask of the ones that were
+ * actually found in the request
+ */
+typedef void (*BoundPageFunction) (HTTPRequestParser& request, void *params, PageParamMask found);
+
 
 struct FileFuncAssociation {
 	PGM_P path;
 	PageFunction function;
+	BoundPageFunction boundFunction;	// Used instead of function if params is set
+	PageParameterArray *params;
+	void *paramData;
 
 	// Methods that (try to) hide the complexity of accessing PROGMEM data
 	PGM_P getPath () const {
@@ -94,6 +311,18 @@ struct FileFuncAssociation {
 	PageFunction getFunction () const {
 		return reinterpret_cast<PageFunction> (pgm_read_ptr (&(this -> function)));
 	}
+
+	BoundPageFunction getBoundFunction () const {
+		return reinterpret_cast<BoundPageFunction> (pgm_read_ptr (&(this -> boundFunction)));
+	}
+
+	PageParameterArray *getParameters () const {
+		return reinterpret_cast<PageParameterArray *> (pgm_read_ptr (&(this -> params)));
+	}
+
+	void *getParameterData () const {
+		return reinterpret_cast<void *> (const_cast<void *> (pgm_read_ptr (&(this -> paramData))));
+	}
 };
 
 #define REPTAG_FFA_VAR(var) _ffa_ ## var
@@ -107,55 +336,233 @@ const FileFuncAssociation var PROGMEM = {REPTAG_FFA_VAR(var), fn};
 #define FlashFileFuncAssoc(var, path, fn) \
 	const FileFuncAssociation var PROGMEM = {path, fn};
 
+/* Use these to associate a BoundPageFunction, along with the array of
+ * parameters it expects and the struct variable they will be stored into. Only
+ * the first MAX_PAGE_PARAMS (16) parameters in the array are used.
+ */
+#define BoundFileFuncAssoc(var, path, fn, params, data) \
+                const char REPTAG_FFA_VAR(var)[] PROGMEM = path; \
+const FileFuncAssociation var PROGMEM = {REPTAG_FFA_VAR(var), nullptr, fn, params, &data};
+
+#define FlashBoundFileFuncAssoc(var, path, fn, params, data) \
+	const FileFuncAssociation var PROGMEM = {path, nullptr, fn, params, &data};
+
 typedef const FileFuncAssociation* const FileFuncAssociationArray;
 #endif
 
 /******************************************************************************/
 
-const byte MAX_STORAGES = 3;
+#ifdef LOOKUP_CACHE_SIZE
+struct LookupCacheEntry {
+	uint32_t hash;			// Of the path
+	Storage* storage;		// nullptr if the path was not found anywhere
+	boolean used;
+};
+#endif
 
 class WebServer {
 private:
 	NetworkInterface* netint;
 
-	Storage* storages[MAX_STORAGES];
-	byte nStorage;
+	// Storages that are searched in order, see addStorage()
+	Storage* storages;
+
+	// Storages mounted at a prefix, longest prefixes first
+	Storage* mounts;
+
+#ifdef LOOKUP_CACHE_SIZE
+	LookupCacheEntry lookupCache[LOOKUP_CACHE_SIZE];
+
+	// Sum of the generations of all storages when the cache was filled
+	uint32_t lookupGeneration;
+
+	uint32_t getStoragesGeneration () const;
+
+	// True if all storages can tell when pages are added
+	boolean canCacheMisses () const;
+#endif
+
+	boolean isAdded (const Storage& storage) const;
 
 #ifdef ENABLE_TAGS
 	const ReplacementTag* const * substitutions = nullptr;
+
+	CachedTag* cachedTags = nullptr;
+
+	const CachedTag* findCachedTag (const ReplacementTag* tag) const;
+
+	// Refreshes the cached tag that is most overdue, if any
+	boolean refreshCachedTags ();
+
+#ifdef TAG_INDEX_SLOTS
+	TagIndexSlot tagIndex[TAG_INDEX_SLOTS];
+	unsigned long tagIndexCounter = 0;
+
+	TagIndexSlot* findTagIndex (Content& content, boolean& hit);
+
+	void sendIndexedTemplate (Print& out, HTTPRequestParser& request, Content& content, const TagIndexSlot& slot);
+#endif
+
+#ifdef RENDER_CACHE_SLOTS
+	RenderCacheSlot renderCache[RENDER_CACHE_SLOTS];
+
+	CacheablePageArray *cacheablePages = nullptr;
+
+	// Set while rendering if the page used something from the request
+	boolean renderUsedRequest;
+
+	const CacheablePage* findCacheablePage (const char* pagename) const;
+
+	RenderCacheSlot* findRenderedPage (const char* pagename, uint32_t etag, unsigned long maxAge, boolean& hit);
+
+	// Makes sure the next request for the page renders it again
+	void dropRenderedPage (const char* pagename);
+
+	/* Renders the page into a slot before sending it, so that it can have
+	 * an ETag. Pages that do not fit only get one with TAG_PAGE_ETAGS.
+	 */
+	void sendRenderedPage (WebClient& client, Content& content, PGM_P contType, unsigned long maxAge);
+#endif
+
+#ifdef TAG_PAGE_ETAGS
+	/* Sends the page with an ETag made from the hash of what it looks like
+	 * once rendered, rendering it again if the client does not have it
+	 */
+	void sendHashedPage (WebClient& client, Content& content, PGM_P contType, uint32_t hash);
+#endif
+
+#ifdef ENABLE_TAG_BLOCKS
+	TagBlocks blocks;
+
+	// Evaluates the REPEAT count or IF condition of a block
+	long evaluateTag (HTTPRequestParser& request, const char* expr, const char* defaultArg, boolean& truth);
+#endif
 #endif
 
 #ifdef ENABLE_PAGE_FUNCTIONS
 	FileFuncAssociationArray *associations = nullptr;
 #endif
 
+#ifdef MAX_EVENT_SUBSCRIBERS
+	EventStream* eventStreams;
+
+	void pruneEventStreams ();
+
+	/* If the request is for an EventStream, subscribes the client to it and
+	 * returns true
+	 */
+	boolean handleEventStream (WebClient& client);
+#endif
+
 	void handleClient (WebClient& client);
 
+	Storage* findStorage (const char* pagename);
+
+	Storage* findMount (const char* pagename) const;
+
 	void sendContent (WebClient& client, Content& content);
 
+	// Sends (up to) len bytes of content as they are
+	void sendRaw (Print& out, Content& content, unsigned long len);
+
 	PGM_P getContentType (const char* filename);
 
 #ifdef ENABLE_TAGS
 	boolean shallReplace (PGM_P contType);
 
-	PString* findSubstitutionTag (const char* tag) const;
+	// Only looks at the first nameLen characters of tag
+	const ReplacementTag* findSubstitutionTag (const char* tag, size_t nameLen) const;
+
+	/* Prints the replacement of a tag, returns false if the tag is unknown.
+	 * defaultArg is passed to tags taking an argument if they have none.
+	 */
+	boolean replaceTag (Print& out, HTTPRequestParser& request, const char* tag, const char* defaultArg);
+
+	/* Handles a tag found in content, which is either a block construct or
+	 * gets replaced. Returns true if the content was moved back to pos.
+	 */
+	boolean processTag (Print& out, HTTPRequestParser& request, Content& content, const char* tag, unsigned long& pos);
+
+	// True if what is being sent is to be thrown away, i.e.: a false #IF#
+	boolean isSkipping () const;
+
+	void sendTemplate (Print& out, HTTPRequestParser& request, Content& content);
+
+	// Reads (up to) len bytes of content and throws them away
+	void skipRaw (Content& content, unsigned long len);
 
 	char *findSubstitutionTagGetParameter (HTTPRequestParser& request, const char* tag);
+
+#ifdef TAGS_JSON_URL
+	// True if replaceTag() would find a replacement for tag
+	boolean isKnownTag (const char* tag) const;
+
+	// Sends a member of the object returned by TAGS_JSON_URL
+	void sendTagJson (WebClient& client, const char* name, size_t len, boolean first);
+
+	void sendTagsJson (WebClient& client);
+#endif
 #endif
 
 public:
+	/* Returns the MIME type with the given index in the table in MimeTypes.h,
+	 * or the fallback one if the index is out of range
+	 */
+	static PGM_P getContentTypeById (byte id);
+
 	boolean begin (NetworkInterface& _netint);
 
+	/* Adds a storage to those that are searched for pages whose URL does not
+	 * fall under any mount point. They are searched in the order they were
+	 * added, until one that has the page is found.
+	 */
 	boolean addStorage (Storage& storage);
 
+	/* Mounts a storage at the given URL prefix (i.e.: "/static"). Requests
+	 * under the prefix go to that storage only, with the prefix removed, so
+	 * that "/static/style.css" will be looked up as "/style.css". If more
+	 * prefixes match, the longest wins. Mounting at "/" catches everything
+	 * that does not fall under another prefix, which means storages added
+	 * with addStorage() will never be used.
+	 *
+	 * The prefix is not copied, so it must stay around.
+	 */
+	boolean mountStorage (const char* prefix, Storage& storage);
+
+#ifdef LOOKUP_CACHE_SIZE
+	/* Forgets where pages were found. Call this after adding or removing files
+	 * on a storage that does not implement Storage::getGeneration().
+	 */
+	void invalidateLookupCache ();
+#endif
+
 #ifdef ENABLE_TAGS
 	void enableReplacementTags (const ReplacementTag* const _substitutions[]);
+
+	/* The tag must also be among those passed to enableReplacementTags(). Its
+	 * value is computed right away.
+	 */
+	boolean addCachedTag (CachedTag& cachedTag);
+
+#ifdef RENDER_CACHE_SLOTS
+	/* Pages with replacement tags are rendered at every request, except for
+	 * those in this list (see CacheablePage)
+	 */
+	void cacheRenderedPages (CacheablePageArray* _pages);
+#endif
 #endif
 
 #ifdef ENABLE_PAGE_FUNCTIONS
 	void associateFunctions (FileFuncAssociationArray* _associations);
 #endif
 
+#ifdef MAX_EVENT_SUBSCRIBERS
+	/* Makes the stream available at its path, which takes precedence over any
+	 * page with the same name
+	 */
+	boolean addEventStream (EventStream& stream);
+#endif
+
 	boolean loop ();
 };
 
@@ -55,17 +55,42 @@ typedef WiFiServer InternalServer;
 #include "WebbinoCore/WebClient.h"
 #include "WebbinoCore/WebServer.h"
 
+#ifdef MAX_EVENT_SUBSCRIBERS
+/* Libraries for WiFi modules with a fixed number of sockets tell how many.
+ * Every connection kept by detach() holds one, and one must be left for the
+ * server, or no other requests would get through.
+ */
+#if defined (MAX_SOCK_NUM) && MAX_SOCK_NUM - 1 < MAX_EVENT_SUBSCRIBERS
+	#define MAX_KEPT_CLIENTS (MAX_SOCK_NUM - 1)
+#else
+	#define MAX_KEPT_CLIENTS MAX_EVENT_SUBSCRIBERS
+#endif
+#endif
+
 
 class WebClientWifi: public WebClient {
 private:
 	InternalClient internalClient;
 
+#ifdef MAX_EVENT_SUBSCRIBERS
+	// Clients that connections are handed over to by detach()
+	static WebClientWifi keptClients[MAX_KEPT_CLIENTS];
+#endif
+
 public:
 	void begin (InternalClient& c, char* req);
 
 	size_t doWrite (const uint8_t *buf, size_t n) override;
 
 	void sendReply () override;
+
+#ifdef MAX_EVENT_SUBSCRIBERS
+	WebClient* detach () override;
+
+	boolean connected () override;
+
+	void close () override;
+#endif
 };
 
 
@@ -74,7 +99,7 @@ private:
 	static byte retBuffer[6];
 
 	InternalServer server;
-	byte ethernetBuffer[MAX_URL_LEN + 16];			// MAX_URL_LEN + X is enough, since we only store the "GET <url> HTTP/1.x" request line
+	byte ethernetBuffer[MAX_URL_LEN + 16 + MAX_HEADERS_LEN];		// We only store the "GET <url> HTTP/1.x" request line and a few headers
 	unsigned int ethernetBufferSize;
 
 	WebClientWifi webClient;
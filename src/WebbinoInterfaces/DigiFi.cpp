@@ -59,6 +59,15 @@ size_t WebClientDigiFi::write (uint8_t c) {
 	return ret;
 }
 
+size_t WebClientDigiFi::write (const uint8_t *data, size_t n) {
+	// Everything must end up in buf, as the whole reply is sent in sendReply()
+	size_t ret = 0;
+	while (ret < n && write (data[ret]))
+		++ret;
+
+	return ret;
+}
+
 void WebClientDigiFi::sendReply () {
 	//~ DPRINTLN (F("HEADERS:"));
 	//~ DPRINT ((char*) buf);
@@ -161,36 +170,36 @@ WebClient* NetworkInterfaceDigiFi::processPacket () {
 		// An http request ends with a blank line
 		boolean currentLineIsBlank = true;
 		ethernetBufferSize = 0;
-		boolean copy = true;
+		unsigned int lineStart = 0;
 		unsigned int startTime = millis ();
 		while (!ret && millis () - startTime < REQUEST_TIMEOUT * 1000L) {
 			if (wifi.available ()) {
 				char c = wifi.read ();
-				if (copy) {
-					if (ethernetBufferSize < sizeof (ethernetBuffer)) {
-						ethernetBuffer[ethernetBufferSize++] = c;
-					} else {
-						DPRINTLN (F("Ethernet buffer overflow"));
-						break;
-					}
+				if (ethernetBufferSize < sizeof (ethernetBuffer) - 1) {		// Leave room for terminator
+					ethernetBuffer[ethernetBufferSize++] = c;
+				} else if (lineStart == 0) {
+					DPRINTLN (F("Ethernet buffer overflow"));
+					break;
 				}
 
 				// If you've gotten to the end of the line (received a newline
 				// character) and the line is blank, the http request has ended,
 				if (c == '\n' && currentLineIsBlank) {
+					ethernetBuffer[lineStart] = '\0';
 					webClient.begin (reinterpret_cast<char *> (ethernetBuffer));
 					ret = &webClient;
-				}
-
-				if (c == '\n') {
-					// See if we got the URL line
-					if (strncmp_P (reinterpret_cast<char *> (ethernetBuffer), PSTR ("GET "), 4) == 0) {
-						// Yes, ignore the rest
-						ethernetBuffer[ethernetBufferSize - 1] = '\0';
-						copy = false;
+				} else if (c == '\n') {
+					/* Only keep the request line and the headers we care about,
+					 * anything else (including header lines that did not fit
+					 * in the buffer) is dropped
+					 */
+					char *line = reinterpret_cast<char *> (ethernetBuffer + lineStart);
+					unsigned int lineLen = ethernetBufferSize - lineStart;
+					if (lineLen > 0 && line[lineLen - 1] == '\n' &&
+						  HTTPRequestParser::isRelevantLine (line, lineLen, lineStart == 0)) {
+						lineStart = ethernetBufferSize;
 					} else {
-						// No, start over
-						ethernetBufferSize = 0;
+						ethernetBufferSize = lineStart;
 					}
 
 					// you're starting a new line
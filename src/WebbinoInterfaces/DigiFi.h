@@ -74,6 +74,10 @@ public:
 
 	size_t write (uint8_t c) override;
 
+	size_t write (const uint8_t *data, size_t n) override;
+
+	using WebClient::write;
+
 	void sendReply () override;
 };
 
@@ -85,7 +89,7 @@ private:
 	DigiFi wifi;
 
 	byte macAddress[6];
-	byte ethernetBuffer[MAX_URL_LEN + 16];			// MAX_URL_LEN + X is enough, since we only store the "GET <url> HTTP/1.x" request line
+	byte ethernetBuffer[MAX_URL_LEN + 16 + MAX_HEADERS_LEN];		// We only store the "GET <url> HTTP/1.x" request line and a few headers
 	unsigned int ethernetBufferSize;
 
 	WebClientDigiFi webClient;
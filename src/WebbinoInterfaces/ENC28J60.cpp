@@ -78,7 +78,12 @@ WebClient *NetworkInterfaceENC28J60::processPacket () {
 	word pos = ether.packetLoop (len);
 
 	if (pos) {
-		// Got a packet
+		// Got a packet, make sure it is terminated before parsing it
+		if (len < sizeof (Ethernet::buffer))
+			Ethernet::buffer[len] = '\0';
+		else
+			Ethernet::buffer[sizeof (Ethernet::buffer) - 1] = '\0';
+
 		client.begin (reinterpret_cast<char *> (Ethernet::buffer + pos));
 		//DPRINTLN ((char *) Ethernet::buffer + pos);
 		ret = &client;
@@ -130,41 +130,43 @@ WebClient* FishinoInterface::processPacket () {
 		// An http request ends with a blank line
 		boolean currentLineIsBlank = true;
 		ethernetBufferSize = 0;
-		boolean copy = true;
+		unsigned int lineStart = 0;
 		while (client.connected ()) {
 			if (client.available ()) {
 				char c = client.read ();
-				if (copy) {
-					if (ethernetBufferSize < sizeof (ethernetBuffer)) {
-						ethernetBuffer[ethernetBufferSize++] = c;
-					} else {
-						DPRINTLN (F("Ethernet buffer overflow"));
-						break;
-					}
+				if (ethernetBufferSize < sizeof (ethernetBuffer) - 1) {		// Leave room for terminator
+					ethernetBuffer[ethernetBufferSize++] = c;
+				} else if (lineStart == 0) {
+					DPRINTLN (F("Ethernet buffer overflow"));
+					break;
 				}
 
 				// If you've gotten to the end of the line (received a newline
 				// character) and the line is blank, the http request has ended
 				if (c == '\n' && currentLineIsBlank) {
+					ethernetBuffer[lineStart] = '\0';
 					webClient.begin (client, reinterpret_cast<char *> (ethernetBuffer));
 					ret = &webClient;
 					break;
 				}
 
 				if (c == '\n') {
-					// See if we got the URL line
-					if (strncmp_P ((char *) ethernetBuffer, PSTR ("GET "), 4) == 0) {
-						// Yes, ignore the rest
-						// FIXME: Avoid buffer underflow
-						ethernetBuffer[ethernetBufferSize - 1] = '\0';
-						copy = false;
+					/* Only keep the request line and the headers we care about,
+					 * anything else (including header lines that did not fit
+					 * in the buffer) is dropped
+					 */
+					char *line = reinterpret_cast<char *> (ethernetBuffer + lineStart);
+					unsigned int lineLen = ethernetBufferSize - lineStart;
+					if (lineLen > 0 && line[lineLen - 1] == '\n' &&
+						  HTTPRequestParser::isRelevantLine (line, lineLen, lineStart == 0)) {
+						lineStart = ethernetBufferSize;
 					} else {
-						// No, start over
 						DPRINT (F("Discarding header line: \""));
-						DPRINT (reinterpret_cast<char *> (ethernetBuffer));
+						ethernetBuffer[ethernetBufferSize] = '\0';
+						DPRINT (line);
 						DPRINTLN (F("\""));
 
-						ethernetBufferSize = 0;
+						ethernetBufferSize = lineStart;
 					}
 
 					// you're starting a new line
@@ -48,7 +48,7 @@ private:
 
 	boolean dhcp;
 	FishinoServer server;
-	byte ethernetBuffer[MAX_URL_LEN + 16];			// MAX_URL_LEN + X is enough, since we only store the "GET <url> HTTP/1.x" request line
+	byte ethernetBuffer[MAX_URL_LEN + 16 + MAX_HEADERS_LEN];		// We only store the "GET <url> HTTP/1.x" request line and a few headers
 	unsigned int ethernetBufferSize;
 
 	FishinoWebClient webClient;
@@ -0,0 +1,247 @@
+/***************************************************************************
+ *   This file is part of Webbino                                          *
+ *                                                                         *
+ *   Copyright (C) 2012-2019 by SukkoPera                                  *
+ *                                                                         *
+ *   Webbino is free software: you can redistribute it and/or modify       *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation, either version 3 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   Webbino is distributed in the hope that it will be useful,            *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with Webbino. If not, see <http://www.gnu.org/licenses/>.       *
+ ***************************************************************************/
+
+#include <Arduino.h>
+#include "HostSockets.h"
+
+#if defined (WEBBINO_USE_HOST_SOCKETS)
+
+#include <webbino_debug.h>
+#include <sys/types.h>
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <errno.h>
+
+// Give up on clients that do not complete their request within this time
+#define CLIENT_TIMEOUT_SEC 5
+
+void WebClientHost::begin (int _fd, char* req) {
+	WebClient::begin (req);
+	fd = _fd;
+}
+
+size_t WebClientHost::doWrite (const uint8_t *buf, size_t n) {
+	size_t written = 0;
+
+	while (written < n) {
+		ssize_t r = send (fd, buf + written, n - written, MSG_NOSIGNAL);
+		if (r > 0) {
+			written += r;
+		} else if (r < 0 && errno == EINTR) {
+			continue;
+		} else {
+			break;
+		}
+	}
+
+	return written;
+}
+
+void WebClientHost::sendReply () {
+	WebClient::sendReply ();
+	if (!detached) {
+		::close (fd);
+		DPRINTLN (F("Client disconnected"));
+	}
+	fd = -1;
+}
+
+#ifdef MAX_EVENT_SUBSCRIBERS
+WebClientHost WebClientHost::keptClients[MAX_EVENT_SUBSCRIBERS];
+
+WebClient* WebClientHost::detach () {
+	WebClientHost* ret = nullptr;
+
+	for (byte i = 0; !ret && i < MAX_EVENT_SUBSCRIBERS; ++i) {
+		if (!keptClients[i].kept)
+			ret = &keptClients[i];
+	}
+
+	if (ret) {
+		flushBuffer ();
+		ret -> fd = fd;
+		ret -> avail = 0;
+		ret -> kept = true;
+		detached = true;
+	}
+
+	return ret;
+}
+
+boolean WebClientHost::connected () {
+	boolean ret = false;
+
+	if (kept) {
+		// A closed connection reads as EOF, an idle one would block
+		char c;
+		ssize_t r = recv (fd, &c, 1, MSG_PEEK | MSG_DONTWAIT);
+		ret = r > 0 || (r < 0 && (errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR));
+	}
+
+	return ret;
+}
+
+void WebClientHost::close () {
+	if (kept) {
+		flushBuffer ();
+		::close (fd);
+		fd = -1;
+		kept = false;
+		DPRINTLN (F("Subscriber disconnected"));
+	}
+}
+#endif
+
+/****************************************************************************/
+
+byte NetworkInterfaceHost::retBuffer[6];
+
+NetworkInterfaceHost::NetworkInterfaceHost (): listenFd (-1) {
+}
+
+boolean NetworkInterfaceHost::begin (uint16_t port) {
+	boolean ret = false;
+
+	listenFd = socket (AF_INET, SOCK_STREAM, 0);
+	if (listenFd >= 0) {
+		int one = 1;
+		setsockopt (listenFd, SOL_SOCKET, SO_REUSEADDR, &one, sizeof (one));
+
+		struct sockaddr_in addr;
+		memset (&addr, 0, sizeof (addr));
+		addr.sin_family = AF_INET;
+		addr.sin_addr.s_addr = htonl (INADDR_ANY);
+		addr.sin_port = htons (port);
+
+		// processPacket() must not block if there are no clients
+		if (bind (listenFd, reinterpret_cast<struct sockaddr *> (&addr), sizeof (addr)) == 0 &&
+			  listen (listenFd, 16) == 0 &&
+			  fcntl (listenFd, F_SETFL, fcntl (listenFd, F_GETFL) | O_NONBLOCK) == 0) {
+			DPRINT (F("Server is listening on port "));
+			DPRINTLN (port);
+			ret = true;
+		} else {
+			DPRINTLN (F("Cannot listen on port"));
+			close (listenFd);
+			listenFd = -1;
+		}
+	}
+
+	return ret;
+}
+
+WebClient* NetworkInterfaceHost::processPacket () {
+	WebClient *ret = NULL;
+
+	struct sockaddr_in addr;
+	socklen_t addrLen = sizeof (addr);
+	int fd = accept (listenFd, reinterpret_cast<struct sockaddr *> (&addr), &addrLen);
+	if (fd >= 0) {
+		DPRINTLN (F("New client"));
+
+		struct timeval tv;
+		tv.tv_sec = CLIENT_TIMEOUT_SEC;
+		tv.tv_usec = 0;
+		setsockopt (fd, SOL_SOCKET, SO_RCVTIMEO, &tv, sizeof (tv));
+
+		// Remember what address the client reached us at
+		struct sockaddr_in local;
+		socklen_t localLen = sizeof (local);
+		if (getsockname (fd, reinterpret_cast<struct sockaddr *> (&local), &localLen) == 0) {
+			uint32_t a = ntohl (local.sin_addr.s_addr);
+			ip = IPAddress (a >> 24, (a >> 16) & 0xFF, (a >> 8) & 0xFF, a & 0xFF);
+		}
+
+		// An http request ends with a blank line
+		boolean currentLineIsBlank = true;
+		ethernetBufferSize = 0;
+		unsigned int lineStart = 0;
+		char chunk[256];
+		ssize_t chunkLen = 0, chunkPos = 0;
+		while (!ret) {
+			if (chunkPos >= chunkLen) {
+				chunkLen = recv (fd, chunk, sizeof (chunk), 0);
+				chunkPos = 0;
+				if (chunkLen <= 0)
+					break;		// Connection closed, error or timeout
+			}
+
+			char c = chunk[chunkPos++];
+			if (ethernetBufferSize < sizeof (ethernetBuffer) - 1) {		// Leave room for terminator
+				ethernetBuffer[ethernetBufferSize++] = c;
+			} else if (lineStart == 0) {
+				DPRINTLN (F("Ethernet buffer overflow"));
+				break;
+			}
+
+			if (c == '\n' && currentLineIsBlank) {
+				ethernetBuffer[lineStart] = '\0';
+				webClient.begin (fd, (char *) ethernetBuffer);
+				ret = &webClient;
+			} else if (c == '\n') {
+				// Only keep the request line and the headers we care about
+				char *line = reinterpret_cast<char *> (ethernetBuffer + lineStart);
+				unsigned int lineLen = ethernetBufferSize - lineStart;
+				if (lineLen > 0 && line[lineLen - 1] == '\n' &&
+					  HTTPRequestParser::isRelevantLine (line, lineLen, lineStart == 0)) {
+					lineStart = ethernetBufferSize;
+				} else {
+					ethernetBufferSize = lineStart;
+				}
+
+				currentLineIsBlank = true;
+			} else if (c != '\r') {
+				currentLineIsBlank = false;
+			}
+		}
+
+		// If we are not returning a client, close the connection
+		if (!ret) {
+			close (fd);
+			DPRINTLN (F("Client disconnected"));
+		}
+	}
+
+	return ret;
+}
+
+boolean NetworkInterfaceHost::usingDHCP () {
+	return false;
+}
+
+byte *NetworkInterfaceHost::getMAC () {
+	memset (retBuffer, 0, sizeof (retBuffer));
+	return retBuffer;
+}
+
+IPAddress NetworkInterfaceHost::getIP () {
+	return ip;
+}
+
+IPAddress NetworkInterfaceHost::getNetmask () {
+	return IPAddress (0, 0, 0, 0);
+}
+
+IPAddress NetworkInterfaceHost::getGateway () {
+	return IPAddress (0, 0, 0, 0);
+}
+
+#endif
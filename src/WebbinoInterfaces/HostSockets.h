@@ -0,0 +1,93 @@
+/***************************************************************************
+ *   This file is part of Webbino                                          *
+ *                                                                         *
+ *   Copyright (C) 2012-2019 by SukkoPera                                  *
+ *                                                                         *
+ *   Webbino is free software: you can redistribute it and/or modify       *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation, either version 3 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   Webbino is distributed in the hope that it will be useful,            *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with Webbino. If not, see <http://www.gnu.org/licenses/>.       *
+ ***************************************************************************/
+
+#ifndef _WEBSERVERHOST_H_
+#define _WEBSERVERHOST_H_
+
+#include <webbino_config.h>
+
+#if defined (WEBBINO_USE_HOST_SOCKETS)
+
+#include <WebbinoCore/WebClient.h>
+#include <WebbinoCore/WebServer.h>
+
+
+class WebClientHost: public WebClient {
+private:
+	int fd = -1;
+
+#ifdef MAX_EVENT_SUBSCRIBERS
+	// Clients that connections are handed over to by detach()
+	static WebClientHost keptClients[MAX_EVENT_SUBSCRIBERS];
+#endif
+
+public:
+	void begin (int _fd, char* req);
+
+	size_t doWrite (const uint8_t *buf, size_t n) override;
+
+	void sendReply () override;
+
+#ifdef MAX_EVENT_SUBSCRIBERS
+	WebClient* detach () override;
+
+	boolean connected () override;
+
+	void close () override;
+#endif
+};
+
+
+/* Serves requests through the BSD sockets API of the host, to run Webbino on a
+ * PC. This needs an implementation of the Arduino core API for the host, e.g.
+ * EpoxyDuino (https://github.com/bxparks/EpoxyDuino).
+ */
+class NetworkInterfaceHost: public NetworkInterface {
+private:
+	static byte retBuffer[6];
+
+	int listenFd;
+	IPAddress ip;
+	byte ethernetBuffer[MAX_URL_LEN + 16 + MAX_HEADERS_LEN];		// We only store the "GET <url> HTTP/1.x" request line and a few headers
+	unsigned int ethernetBufferSize;
+
+	WebClientHost webClient;
+
+public:
+	NetworkInterfaceHost ();
+
+	// Use a port above 1024 unless running as root
+	boolean begin (uint16_t port = SERVER_PORT);
+
+	WebClient* processPacket () override;
+
+	boolean usingDHCP () override;
+
+	byte *getMAC () override;
+
+	IPAddress getIP () override;
+
+	IPAddress getNetmask () override;
+
+	IPAddress getGateway () override;
+};
+
+#endif
+
+#endif
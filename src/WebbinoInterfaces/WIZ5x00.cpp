@@ -36,10 +36,48 @@ size_t WebClientWIZ5x00::doWrite (const uint8_t *buf, size_t n) {
 
 void WebClientWIZ5x00::sendReply () {
 	WebClient::sendReply ();
-	internalClient.stop ();
-	DPRINTLN (F("Client disconnected"));
+	if (!detached) {
+		internalClient.stop ();
+		DPRINTLN (F("Client disconnected"));
+	}
+}
+
+#ifdef MAX_EVENT_SUBSCRIBERS
+WebClientWIZ5x00 WebClientWIZ5x00::keptClients[MAX_KEPT_CLIENTS];
+
+WebClient* WebClientWIZ5x00::detach () {
+	WebClientWIZ5x00* ret = nullptr;
+
+	for (byte i = 0; !ret && i < MAX_KEPT_CLIENTS; ++i) {
+		if (!keptClients[i].kept)
+			ret = &keptClients[i];
+	}
+
+	if (ret) {
+		flushBuffer ();
+		ret -> internalClient = internalClient;
+		ret -> avail = 0;
+		ret -> kept = true;
+		detached = true;
+	}
+
+	return ret;
 }
 
+boolean WebClientWIZ5x00::connected () {
+	return kept && internalClient.connected ();
+}
+
+void WebClientWIZ5x00::close () {
+	if (kept) {
+		flushBuffer ();
+		internalClient.stop ();
+		kept = false;
+		DPRINTLN (F("Subscriber disconnected"));
+	}
+}
+#endif
+
 /****************************************************************************/
 
 byte NetworkInterfaceWIZ5x00::retBuffer[6];
@@ -98,36 +136,38 @@ WebClient* NetworkInterfaceWIZ5x00::processPacket () {
 		// An http request ends with a blank line
 		boolean currentLineIsBlank = true;
 		ethernetBufferSize = 0;
-		boolean copy = true;
+		unsigned int lineStart = 0;
 		while (client.connected ()) {
 			if (client.available ()) {
 				char c = client.read ();
-				if (copy) {
-					if (ethernetBufferSize < sizeof (ethernetBuffer)) {
-						ethernetBuffer[ethernetBufferSize++] = c;
-					} else {
-						DPRINTLN (F("Ethernet buffer overflow"));
-						break;
-					}
+				if (ethernetBufferSize < sizeof (ethernetBuffer) - 1) {		// Leave room for terminator
+					ethernetBuffer[ethernetBufferSize++] = c;
+				} else if (lineStart == 0) {
+					DPRINTLN (F("Ethernet buffer overflow"));
+					break;
 				}
 
 				// If you've gotten to the end of the line (received a newline
 				// character) and the line is blank, the http request has ended,
 				if (c == '\n' && currentLineIsBlank) {
+					ethernetBuffer[lineStart] = '\0';
 					webClient.begin (client, (char *) ethernetBuffer);
 					ret = &webClient;
 					break;
 				}
 
 				if (c == '\n') {
-					// See if we got the URL line
-					if (strncmp_P ((char *) ethernetBuffer, PSTR ("GET "), 4) == 0) {
-						// Yes, ignore the rest
-						ethernetBuffer[ethernetBufferSize - 1] = '\0';
-						copy = false;
+					/* Only keep the request line and the headers we care about,
+					 * anything else (including header lines that did not fit
+					 * in the buffer) is dropped
+					 */
+					char *line = reinterpret_cast<char *> (ethernetBuffer + lineStart);
+					unsigned int lineLen = ethernetBufferSize - lineStart;
+					if (lineLen > 0 && line[lineLen - 1] == '\n' &&
+						  HTTPRequestParser::isRelevantLine (line, lineLen, lineStart == 0)) {
+						lineStart = ethernetBufferSize;
 					} else {
-						// No, start over
-						ethernetBufferSize = 0;
+						ethernetBufferSize = lineStart;
 					}
 
 					// you're starting a new line
@@ -35,17 +35,49 @@
 #include <WebbinoCore/WebClient.h>
 #include <WebbinoCore/WebServer.h>
 
+#ifdef MAX_EVENT_SUBSCRIBERS
+/* Every connection kept by detach() holds one of the sockets of the chip, and
+ * one must be left for the server to listen on, or no other requests would get
+ * through. The W5100 only has 4, even if newer versions of the Ethernet library
+ * allow for more.
+ */
+#if defined (WEBBINO_USE_WIZ5100) && MAX_SOCK_NUM > 4
+	#define WIZ_SOCKETS 4
+#elif defined (MAX_SOCK_NUM)
+	#define WIZ_SOCKETS MAX_SOCK_NUM
+#endif
+
+#if defined (WIZ_SOCKETS) && WIZ_SOCKETS - 1 < MAX_EVENT_SUBSCRIBERS
+	#define MAX_KEPT_CLIENTS (WIZ_SOCKETS - 1)
+#else
+	#define MAX_KEPT_CLIENTS MAX_EVENT_SUBSCRIBERS
+#endif
+#endif
+
 
 class WebClientWIZ5x00: public WebClient {
 private:
 	EthernetClient internalClient;
 
+#ifdef MAX_EVENT_SUBSCRIBERS
+	// Clients that connections are handed over to by detach()
+	static WebClientWIZ5x00 keptClients[MAX_KEPT_CLIENTS];
+#endif
+
 public:
 	void begin (EthernetClient& c, char* req);
 
 	size_t doWrite (const uint8_t *buf, size_t n) override;
 
 	void sendReply () override;
+
+#ifdef MAX_EVENT_SUBSCRIBERS
+	WebClient* detach () override;
+
+	boolean connected () override;
+
+	void close () override;
+#endif
 };
 
 
@@ -56,7 +88,7 @@ private:
 	boolean dhcp;
 	byte macAddress[6];
 	EthernetServer server;
-	byte ethernetBuffer[MAX_URL_LEN + 16];			// MAX_URL_LEN + X is enough, since we only store the "GET <url> HTTP/1.x" request line
+	byte ethernetBuffer[MAX_URL_LEN + 16 + MAX_HEADERS_LEN];		// We only store the "GET <url> HTTP/1.x" request line and a few headers
 	unsigned int ethernetBufferSize;
 
 	WebClientWIZ5x00 webClient;
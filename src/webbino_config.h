@@ -33,6 +33,7 @@
 //~ #define WEBBINO_USE_WIFI101
 //~ #define WEBBINO_USE_FISHINO
 //~ #define WEBBINO_USE_DIGIFI
+//~ #define WEBBINO_USE_HOST_SOCKETS
 
 /* Define to enable serving webpages from SD. This will use Arduino's SD
  * library, which only allows DOS-style (i.e. 8+3 characters) file names. This
@@ -48,6 +49,32 @@
  */
 //~ #define WEBBINO_ENABLE_SDFAT
 
+/* Files on SD are read in blocks of this size. Using a multiple of the sector
+ * size (i.e.: 512 bytes) gives the best throughput, if you can spare the RAM.
+ */
+#if defined (ARDUINO_ARCH_AVR)
+#define SD_READ_BUFSIZE 64
+#else
+#define SD_READ_BUFSIZE 512
+#endif
+
+/* Define to read files that are stored contiguously on the card (which is
+ * usually the case, unless the card is very fragmented) with raw multi-sector
+ * reads, bypassing the filesystem layer. This requires SdFat 2.x and only
+ * helps with contents that are sent in chunks of at least 512 bytes (see
+ * SEND_CHUNK_SIZE), i.e. those without replacement tags.
+ */
+//~ #define WEBBINO_SDFAT_RAW_READS
+
+/* Define to have SdStorage build an index of all the files on the card when
+ * begin() is called, so that finding out if a file exists takes no card access.
+ * This is the maximum number of files that will be indexed, each one takes 4
+ * bytes of RAM. If there are more files than this, those that did not fit will
+ * be looked up on the card as usual. Call SdStorage::refreshIndex() after
+ * adding or removing files.
+ */
+//~ #define WEBBINO_SD_INDEX_SIZE 64
+
 // Define to enable running functions upon request of certain pages
 #define ENABLE_PAGE_FUNCTIONS
 
@@ -59,6 +86,18 @@
 #define WEBBINO_ENABLE_SPIFFS
 #endif
 
+/* Define to enable serving webpages from LittleFS, on ESP8266 and ESP32. Since
+ * SPIFFS is deprecated, this should be preferred on new projects.
+ */
+//~ #define WEBBINO_ENABLE_LITTLEFS
+
+/* Define to enable serving webpages from a directory of the host, when running
+ * on a PC. By default this is always enabled if using host sockets.
+ */
+#ifdef WEBBINO_USE_HOST_SOCKETS
+#define WEBBINO_ENABLE_HOSTFS
+#endif
+
 /* By default, only MIME types for html, css, js, png, jpeg, gif and ico files
  * are enabled. Define this to enable some extra types, namely xml, pdf, zip and
  * gz files.
@@ -78,10 +117,85 @@
  */
 #define TAG_CHAR '#'
 
-/* Maximum length of a tag name
+/* Character that separates the name of a tag from its argument, i.e.:
+ * #RELAY:3#
+ */
+#define TAG_ARG_CHAR ':'
+
+/* Maximum length of a tag name, argument included
  */
 #define MAX_TAG_LEN 24
 
+/* Number of pages whose tag positions are remembered, so that the next time
+ * they are served the text between tags can be sent in bulk, without looking
+ * at every byte. Only pages whose storage provides an ETag can be indexed
+ * (i.e.: not those on SD cards accessed through the SD library). Every slot
+ * takes about 5 * TAG_INDEX_MAX_TAGS bytes of RAM, pages with more tags than
+ * that are not indexed. Comment out to disable.
+ */
+#if !defined (ARDUINO_ARCH_AVR)
+#define TAG_INDEX_SLOTS 4
+#endif
+#define TAG_INDEX_MAX_TAGS 32
+
+/* Maximum length of the value of a CachedTag, terminator included
+ */
+#define CACHED_TAG_LEN 24
+
+/* Enable blocks in pages with replacement tags: #REPEAT:n#...#END# sends what
+ * is in between n times, where n is either a number or a tag (i.e.:
+ * #REPEAT:NCHANNELS#), while #IF:tag#...#ENDIF# only sends it if the tag is
+ * known and its value is neither empty nor "0". Within a repeat, #INDEX# is
+ * replaced with the number of the current iteration (starting from 0), which
+ * is also passed to tags taking an argument when they are used without one.
+ * Repeats can be nested up to MAX_TAG_BLOCK_DEPTH levels and need a storage
+ * that can seek.
+ */
+#define ENABLE_TAG_BLOCKS
+#define MAX_TAG_BLOCK_DEPTH 4
+
+/* Define to send pages with replacement tags with an ETag made from what they
+ * look like once rendered, so that clients polling them get a short "304 Not
+ * Modified" reply until something changes. To find that out, pages are
+ * rendered once without sending anything, then again if they have to be sent:
+ * tags are thus evaluated twice, unless the reply is a 304. Comment out to
+ * disable.
+ */
+#define TAG_PAGE_ETAGS
+
+/* Define to allow pages with replacement tags to be kept in RAM once sent, and
+ * be sent again from there for a while, without evaluating their tags again.
+ * Only the pages passed to WebServer::cacheRenderedPages() are cached, each
+ * with its own maximum age. Every slot takes about RENDER_CACHE_LEN bytes of
+ * RAM, pages that come out longer than that are not cached. Neither are pages
+ * using GETP_ tags, while pages with an associated function are rendered again
+ * whenever it is called. Cached pages that fit also get their ETag (see
+ * TAG_PAGE_ETAGS) without rendering them twice.
+ */
+//~ #define RENDER_CACHE_SLOTS 2
+#define RENDER_CACHE_LEN 1024
+
+/* Define to have a built-in page at this URL that returns the values of the
+ * tags listed in its t parameter as a JSON object, i.e.:
+ * /tags.json?t=UPTIME,RELAY:3 gives {"UPTIME":"1:02:03","RELAY:3":"ON"}.
+ * Unknown tags are null, all tags are returned if the parameter is missing.
+ */
+//~ #define TAGS_JSON_URL "/tags.json"
+
+/* Maximum number of clients that can be subscribed to EventStreams at the same
+ * time, across all streams. Each of them keeps a connection open and takes as
+ * much RAM as a WebClient. Only the WizNet, WiFi and host interfaces support
+ * this. Each subscriber also holds a socket: on WizNet chips and WiFi modules
+ * one socket is always left free for other requests, so a W5100 (which has 4)
+ * can have at most 3 subscribers. The ESP8266 only allows 5 TCP connections
+ * by default, hence the lower limit. Comment out to disable.
+ */
+#if defined (ESP8266)
+#define MAX_EVENT_SUBSCRIBERS 2
+#elif !defined (ARDUINO_ARCH_AVR)
+#define MAX_EVENT_SUBSCRIBERS 4
+#endif
+
 /* Maximum length of a filename in the Flash storage
  */
 #define MAX_FLASH_FNLEN 16
@@ -94,6 +208,18 @@
  */
 #define MAX_URL_LEN 128
 
+/* Room reserved in the request buffer of network interfaces for the request
+ * headers we make use of (If-None-Match, etc.). Headers that do not fit are
+ * ignored.
+ */
+#define MAX_HEADERS_LEN 64
+
+/* Maximum length of the value of the If-None-Match request header. Longer
+ * values are truncated, which at worst means that a full response is sent
+ * where a 304 would have been enough.
+ */
+#define MAX_IF_NONE_MATCH_LEN 24
+
 /* TCP port the server will listen on
  *
  * NOTE: Port 80 can not be used with DigiFi
@@ -116,6 +242,32 @@
  */
 #define CLIENT_BUFSIZE 64
 
+/* Contents that do not undergo tag replacement are read and sent in chunks of
+ * this size. The chunk lives on the stack, so keep it small on smaller MCUs.
+ */
+#if defined (ARDUINO_ARCH_AVR)
+#define SEND_CHUNK_SIZE 32
+#else
+#define SEND_CHUNK_SIZE 512
+#endif
+
+/* Number and size of the RAM slots CachingStorage uses to keep frequently
+ * requested files. Files bigger than a slot are never cached. Note that the
+ * whole pool (i.e.: CACHE_SLOTS * CACHE_SLOT_SIZE bytes) is allocated as soon
+ * as you instantiate a CachingStorage.
+ */
+#define CACHE_SLOTS 4
+#define CACHE_SLOT_SIZE 1024
+
+/* Number of entries of the cache WebServer uses to remember which storage holds
+ * a given path, so that it does not need to ask all of them on every request.
+ * Every entry takes 9 bytes of RAM (7 on AVR). Paths that were not found are
+ * only remembered if all storages have fixed contents or can tell when their
+ * files change (i.e.: SdStorage with WEBBINO_SD_INDEX_SIZE, after
+ * refreshIndex()). Comment out to disable.
+ */
+#define LOOKUP_CACHE_SIZE 8
+
 /* Define this to store strings in flash memory. This saves RAM on smaller MCUs,
  * recommended on AVRs, works fine on ESP8266 standalone, probably not supported
  * on other targets.
@@ -68,6 +68,8 @@
 #define strncpy_P strncpy
 #undef strncmp_P
 #define strncmp_P strncmp
+#undef strncasecmp_P
+#define strncasecmp_P strncasecmp
 
 #undef pgm_read_ptr
 #define pgm_read_ptr(p) (*(p))
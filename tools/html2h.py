@@ -21,9 +21,18 @@
 # Run this script like this:
 # ./html2h.py webroot > html.h
 #
+# Or, to get a packed image to be used with PackedFlashStorage:
+# ./html2h.py --packed webroot > site.h
+#
+# Add --far to place the image above the first 64 KB of flash on the Mega2560.
+#
+# Or, to get a binary image to be used with MappedStorage:
+# ./html2h.py --binary webroot > site.bin
+#
 # Note that this is untested on Windows/OSX!
 
 import os
+import struct
 import sys
 
 # https://www.safaribooksonline.com/library/view/python-cookbook/0596001673/ch04s16.html
@@ -42,6 +51,29 @@ def splitall (path):
             allparts.insert(0, parts[1])
     return allparts
 
+# 32-bit FNV-1a, same as the one in WebbinoCore/Hash.h
+FNV_OFFSET_BASIS = 2166136261
+FNV_PRIME = 16777619
+
+def fnv1a (h, b):
+	return ((h ^ b) * FNV_PRIME) & 0xFFFFFFFF
+
+def fnv1a_str (s):
+	h = FNV_OFFSET_BASIS
+	for c in s:
+		h = fnv1a (h, ord (c))
+	return h
+
+# Extensions of the MIME types in WebbinoCore/MimeTypes.h, in the same order
+MIME_EXTS = ["htm", "html", "css", "js", "txt", "png", "gif", "jpg", "ico", "xml", "pdf", "zip", "gz"]
+MIME_UNKNOWN = 0xFF
+
+# Flags of packed entries, see WebbinoCore/PackedFlashStorage.h
+FLAG_TAGS = 1 << 0
+
+# Same as PackedImage::FAR_CHUNK_SIZE
+FAR_CHUNK_SIZE = 16384
+
 def shallStrip (filename):
 	name, ext = os.path.splitext (filename)
 	if len (ext) > 1:
@@ -49,71 +81,192 @@ def shallStrip (filename):
 	ext = ext.lower ()
 	return ext == "htm" or ext == "html"
 
-def process_file (filename, nostrip = False):
+def make_pagename (filename):
+	pagename = filename[1:]
+
+	# Convert Windows slashes to Posix slashes
+	return pagename.replace ('\\', '/')
+
+# Returns the contents of a file, stripped if needed, as a string
+def read_file (filename, nostrip = False):
 	print >> sys.stderr, "Processing file: %s" % filename
 
 	if not nostrip and not shallStrip (filename):
 		print >> sys.stderr, "- File will not be stripped"
 		nostrip = True
 
+	with open (filename, 'rb') as fp:
+		data = fp.read ()
+
+	if not nostrip:
+		data = data.replace ('\n', '').replace ('\r', '').replace ('\t', '')
+
+	return data
+
+# ETag is a hash of the contents, 0 is reserved for "no ETag"
+def make_etag (data):
+	etag = FNV_OFFSET_BASIS
+	for b in data:
+		etag = fnv1a (etag, ord (b))
+
+	if etag == 0:
+		etag = 1
+
+	return etag
+
+def print_bytes (data):
+	for i, b in enumerate (data):
+		if i % 8 == 0:
+			print "\t",
+		print "0x%02x, " % ord (b),
+		if (i + 1) % 8 == 0:
+			print ""
+
+def process_file (filename, nostrip = False):
 	try:
-		with open (filename, 'rb') as fp:
-			# Make up a unique ID for every file to use in C identifiers
-			parts = splitall (filename[2:])
-			parts = [parts[0]] + [x.capitalize () for x in parts[1:]]
-			code = "".join (parts)
-			code = code.replace ('.', '_')
-			code = code.replace ('-', '_')
-			pagename = filename[1:]
-
-			# Convert Windows slashes to Posix slashes
-			pagename = pagename.replace ('\\', '/')
-
-			print "const char %s_name[] PROGMEM = \"%s\";" % (code, pagename)
-			print
-			print "const byte %s[] PROGMEM = {" % code
-			i = 0
-			b = fp.read (1)
-			while len (b) > 0:
-				if nostrip or (b != '\n' and b != '\r' and b != '\t'):
-					if i % 8 == 0:
-						print "\t",
-					print "0x%02x, " % ord (b),
-					i += 1
-					if i % 8 == 0:
-						print ""
-				b = fp.read (1)
+		data = read_file (filename, nostrip)
 
-			print "\n};"
-			print
-			print "const unsigned int %s_len PROGMEM = %u;" % (code, i)
-			print
+		# Make up a unique ID for every file to use in C identifiers
+		parts = splitall (filename[2:])
+		parts = [parts[0]] + [x.capitalize () for x in parts[1:]]
+		code = "".join (parts)
+		code = code.replace ('.', '_')
+		code = code.replace ('-', '_')
+
+		print "const char %s_name[] PROGMEM = \"%s\";" % (code, make_pagename (filename))
+		print
+		print "const byte %s[] PROGMEM = {" % code
+		print_bytes (data)
+		print "\n};"
+		print
+		print "const unsigned int %s_len PROGMEM = %u;" % (code, len (data))
+		print
+		print "const uint32_t %s_etag PROGMEM = 0x%08xUL;" % (code, make_etag (data))
+		print
 	except IOError as ex:
 		print "Cannot open file %s: %s" % (filename, str (ex))
 		code = None
 
 	return code
 
-def process_dir (dirpath, nostrip = False):
+def list_dir (dirpath):
 	print >> sys.stderr, "Processing directory: %s" % dirpath
-	idents = []
+	files = []
 	for filename in sorted (os.listdir (dirpath)):
 		fullfile = os.path.join (dirpath, filename)
 		if os.path.isfile (fullfile):
-			ident = process_file (fullfile, nostrip)
-			if ident is not None:
-				idents.append (ident)
+			files.append (fullfile)
 		elif os.path.isdir (fullfile):
-			idents += process_dir (fullfile, nostrip)
+			files += list_dir (fullfile)
 		else:
 			print "Skipping %s" % filename
+	return files
+
+def process_dir (dirpath, nostrip = False):
+	idents = []
+	for filename in list_dir (dirpath):
+		ident = process_file (filename, nostrip)
+		if ident is not None:
+			idents.append (ident)
 	return idents
 
+def mime_id (pagename):
+	name, ext = os.path.splitext (pagename)
+	ext = ext[1:]
+	return MIME_EXTS.index (ext) if ext in MIME_EXTS else MIME_UNKNOWN
+
+# Header of binary images, see WebbinoCore/MappedStorage.h
+BINARY_MAGIC = "WBPK"
+
+# Returns the blob and the index of a packed image
+def pack_dir (dirpath, nostrip = False, tagchar = '#'):
+	entries = []
+	for filename in list_dir (dirpath):
+		try:
+			data = read_file (filename, nostrip)
+			entries.append ((make_pagename (filename), data))
+		except IOError as ex:
+			print >> sys.stderr, "Cannot open file %s: %s" % (filename, str (ex))
+
+	# Names go first, then contents
+	blob = ""
+	nameOffsets = []
+	for pagename, data in entries:
+		nameOffsets.append (len (blob))
+		blob += pagename + '\0'
+
+	index = []
+	for (pagename, data), nameOffset in zip (entries, nameOffsets):
+		flags = FLAG_TAGS if tagchar in data else 0
+		index.append ((fnv1a_str (pagename), nameOffset, len (blob), len (data), make_etag (data), mime_id (pagename), flags, pagename))
+		blob += data
+
+	# Sort by hash, for binary search
+	index.sort ()
+
+	return blob, index
+
+# Emits a packed image, returns the number of files it contains
+def process_packed (dirpath, symbol, nostrip = False, tagchar = '#', far = False):
+	blob, index = pack_dir (dirpath, nostrip, tagchar)
+
+	print "/* Packed image generated by html2h.py, do not edit */"
+	print
+	if far:
+		# No object can be bigger than 32 KB on AVR, so split the blob
+		chunks = []
+		for n, start in enumerate (xrange (0, len (blob), FAR_CHUNK_SIZE)):
+			chunks.append ("%s_data%u" % (symbol, n))
+			print "const byte %s[] WEBBINO_FAR_PROGMEM = {" % chunks[-1]
+			print_bytes (blob[start:start + FAR_CHUNK_SIZE])
+			print "\n};"
+			print
+	else:
+		print "const byte %s_data[] PROGMEM = {" % symbol
+		print_bytes (blob)
+		print "\n};"
+		print
+	print "const PackedEntry %s_index[] PROGMEM = {" % symbol
+	for e in index:
+		print "\t{0x%08xUL, %u, %u, %u, 0x%08xUL, %u, 0x%02x},\t\t// %s" % e
+	print "};"
+	print
+	if far:
+		print "const PackedImage %s PROGMEM = {nullptr, %s_index, %u};" % (symbol, symbol, len (index))
+		print
+		print "#define %s_FAR_CHUNK_COUNT %u" % (symbol, len (chunks))
+		print
+		print "/* Far addresses can only be taken at runtime, so call this in setup() and"
+		print " * pass the array to PackedFlashStorage::begin()"
+		print " */"
+		print "static inline void %s_fillFarChunks (FlashAddr *chunks) {" % symbol
+		for n, c in enumerate (chunks):
+			print "\tchunks[%u] = WEBBINO_FAR_ADDRESS (%s);" % (n, c)
+		print "}"
+	else:
+		print "const PackedImage %s PROGMEM = {%s_data, %s_index, %u};" % (symbol, symbol, symbol, len (index))
+
+	return len (index)
+
+# Emits a binary image, returns the number of files it contains
+def process_binary (dirpath, nostrip = False, tagchar = '#'):
+	blob, index = pack_dir (dirpath, nostrip, tagchar)
+
+	# Entries are laid out as a PackedEntry on a 32-bit little-endian CPU
+	out = BINARY_MAGIC + struct.pack ("<HH", len (index), 0)
+	for e in index:
+		out += struct.pack ("<IIIIIBBxx", *e[:7])
+	out += blob
+
+	sys.stdout.write (out)
+
+	return len (index)
+
 def make_include_code (idents):
 	ret = ""
 
 	for n, ident in enumerate (idents):
-		ret += "const Page page%02d PROGMEM = {%s_name, %s, %s_len};\n" % (n + 1, ident, ident, ident)
+		ret += "const Page page%02d PROGMEM = {%s_name, %s, %s_len, %s_etag};\n" % (n + 1, ident, ident, ident, ident)
 
 	ret += "\n"
 
@@ -136,12 +289,52 @@ if __name__ == "__main__":
 	parser.add_argument ('webroot', metavar = "WEBROOT", help = "Path to website root directory")
 	parser.add_argument ('--nostrip', "-n", action = 'store_true', default = False,
 						 help = "Do not strip CR/LF/TABs")
+	parser.add_argument ('--packed', "-p", action = 'store_true', default = False,
+						 help = "Produce a packed image for PackedFlashStorage")
+	parser.add_argument ('--far', "-f", action = 'store_true', default = False,
+						 help = "Produce a packed image that can be placed anywhere in flash on the Mega2560 (Implies --packed)")
+	parser.add_argument ('--binary', "-b", action = 'store_true', default = False,
+						 help = "Produce a binary image for MappedStorage")
+	parser.add_argument ('--symbol', "-s", default = "site",
+						 help = "Name of the packed image variable (Default: site)")
+	parser.add_argument ('--tagchar', "-t", default = "#",
+						 help = "Character that delimits replacement tags, must match TAG_CHAR (Default: #)")
 
 	args = parser.parse_args ()
 
 	# The above will raise an error if webroot was not specified, so we can
 	# assume it was
 	os.chdir (args.webroot)
+
+	if args.binary:
+		n_pages = process_binary (".", args.nostrip, args.tagchar)
+		print >> sys.stderr, "Total files processed: %d" % n_pages
+		print >> sys.stderr
+		print >> sys.stderr, "Flash the image to a data partition (ESP32) or put it in a file (PC), then"
+		print >> sys.stderr, "serve it with a MappedStorage"
+		sys.exit (0)
+
+	if args.packed or args.far:
+		n_pages = process_packed (".", args.symbol, args.nostrip, args.tagchar, args.far)
+		print >> sys.stderr, "Total files processed: %d" % n_pages
+		print >> sys.stderr
+		print >> sys.stderr, "Put the following in your sketch:"
+		print >> sys.stderr
+		print >> sys.stderr, '#include "%s.h"' % args.symbol
+		print >> sys.stderr
+		print >> sys.stderr, "PackedFlashStorage flashStorage;"
+		if args.far:
+			print >> sys.stderr, "FlashAddr %sChunks[%s_FAR_CHUNK_COUNT];" % (args.symbol, args.symbol)
+		print >> sys.stderr
+		print >> sys.stderr, "And then, in setup():"
+		print >> sys.stderr
+		if args.far:
+			print >> sys.stderr, "%s_fillFarChunks (%sChunks);" % (args.symbol, args.symbol)
+			print >> sys.stderr, "flashStorage.begin (&%s, %sChunks);" % (args.symbol, args.symbol)
+		else:
+			print >> sys.stderr, "flashStorage.begin (&%s);" % args.symbol
+		sys.exit (0)
+
 	idents = process_dir (".", args.nostrip)
 	n_pages = len (idents)
 